@@ -70,6 +70,14 @@ struct CM_DESTROYEVENT_PARAM
     int32_t returnValue;  // [out]
 };
 
+struct CM_GETEVENTCOMPLETIONFD_PARAM
+{
+    void *cmQueueHandle;  // [in]
+    void *cmEventHandle;  // [in]
+    int32_t fd;           // [out]
+    int32_t returnValue;  // [out]
+};
+
 struct CM_ENQUEUE_GPUCOPY_V2V_PARAM
 {
     void *cmQueueHandle;   // [in]
@@ -876,6 +884,45 @@ CM_RT_API int32_t CmQueue_RT::SetResidentGroupAndParallelThreadNum(uint32_t resi
     return CM_NOT_IMPLEMENTED;
 }
 
+//!
+//! Get a sync file descriptor signaled when the task of the event finishes.
+//! Older drivers don't know the request, so it is only sent when the driver
+//! reports CM_DDI_7_3 or later.
+//! Arguments:
+//!     1. Pointer to the CmEvent generated by Enqueue
+//!     2. Reference to the file descriptor, -1 if failed
+//! Return Value:
+//!     CM_SUCCESS if the descriptor is returned
+//!     CM_NOT_IMPLEMENTED if the driver or kernel does not support it
+//!
+CM_RT_API int32_t CmQueue_RT::GetEventCompletionFd(CmEvent *event, int32_t &fd)
+{
+    INSERT_PROFILER_RECORD();
+    fd = -1;
+    if (event == nullptr)
+    {
+        return CM_INVALID_ARG_VALUE;
+    }
+
+    if (m_cmDev->GetCmVersion() < CM_DDI_7_3)
+    {
+        return CM_NOT_IMPLEMENTED;
+    }
+
+    CM_GETEVENTCOMPLETIONFD_PARAM inParam;
+    CmSafeMemSet(&inParam, 0, sizeof(inParam));
+    inParam.cmQueueHandle = m_cmQueueHandle;
+    inParam.cmEventHandle = event;
+    inParam.fd = -1;
+
+    int32_t hr = m_cmDev->OSALExtensionExecute(CM_FN_CMQUEUE_GETEVENTCOMPLETIONFD,
+                                                &inParam, sizeof(inParam));
+    CHK_FAILURE_RETURN(hr);
+    CHK_FAILURE_RETURN(inParam.returnValue);
+    fd = inParam.fd;
+    return CM_SUCCESS;
+}
+
 
 CM_RT_API int32_t CmQueue_RT::EnqueueReadBuffer(CmBuffer* buffer,
                                                 size_t offset,
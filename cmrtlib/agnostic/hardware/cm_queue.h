@@ -174,6 +174,8 @@ public:
 
     CM_RT_API int32_t SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum);
 
+    CM_RT_API int32_t GetEventCompletionFd(CmEvent *event, int32_t &fd);
+
     CM_QUEUE_CREATE_OPTION GetQueueOption();
 
 
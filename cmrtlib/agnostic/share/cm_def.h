@@ -57,6 +57,7 @@
 #define CM_DDI_6_0 600
 #define CM_DDI_7_0 700
 #define CM_DDI_7_2 702 //for MDFRT API refreshment.
+#define CM_DDI_7_3 703 //for CmQueue::GetEventCompletionFd
 
 //Error code definition
 typedef enum _CM_RETURN_CODE
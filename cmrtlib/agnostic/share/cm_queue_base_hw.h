@@ -608,6 +608,25 @@ public:
     //!
     CM_RT_API virtual int32_t SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum) = 0;
 
+    //!
+    //! \brief      Get a file descriptor which is signaled when the task
+    //!             associated with the event finishes execution on GPU.
+    //! \details    The descriptor becomes readable when the task finishes, so
+    //!             it can be added to the poll/epoll loop of application
+    //!             instead of polling the event. The caller owns the
+    //!             descriptor and must close it. Only supported on Linux with
+    //!             a driver reporting CM_DDI_7_3 or later.
+    //! \param      [in] event
+    //!             Pointer to the event generated by Enqueue.
+    //! \param      [out] fd
+    //!             Reference to the file descriptor, -1 if failed.
+    //! \retval     CM_SUCCESS if the descriptor is successfully returned.
+    //! \retval     CM_INVALID_ARG_VALUE if event is nullptr.
+    //! \retval     CM_NOT_IMPLEMENTED if the driver or kernel does not
+    //!             support fence export.
+    //!
+    CM_RT_API virtual int32_t GetEventCompletionFd(CmEvent *event, int32_t &fd) = 0;
+
 protected:
     virtual ~CmQueue() = default;
 };
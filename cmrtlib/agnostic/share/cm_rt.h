@@ -1527,6 +1527,7 @@ public:
     CM_RT_API virtual int32_t EnqueueWriteBuffer(CmBuffer* buffer, size_t offset, const unsigned char* sysMem, uint64_t sysMemSize, CmEvent* wait_event, CmEvent*& event, unsigned option) = 0;
 
     CM_RT_API virtual INT SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum) = 0;
+    CM_RT_API virtual INT GetEventCompletionFd(CmEvent* pEvent, INT& fd) = 0;
 
 protected:
     ~CmQueue(){};
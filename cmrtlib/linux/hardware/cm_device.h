@@ -149,6 +149,8 @@ public:
 
     int32_t CheckDdiVersionSupported(const uint32_t ddiVersion);
 
+    uint32_t GetCmVersion() { return m_cmVersion; }
+
     int32_t OSALExtensionExecute(uint32_t functionId,
                                  void *inputData,
                                  uint32_t inputDataLength,
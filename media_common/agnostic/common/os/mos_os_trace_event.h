@@ -397,6 +397,7 @@ typedef enum _MEDIA_EVENT
     EVENT_DECODE_IP_ALIGNMENT,                     //! event for Decode IP Alignment
     EVENT_ENCODE_IP_ALIGNMENT,                     //! event for Encode IP Alignment
     EVENT_VPP_IP_ALIGNMENT,                        //! event for VPP IP Alignment
+    EVENT_VA_INIT,                                 //! event for VA initialize stage time
 } MEDIA_EVENT;
 
 typedef enum _MEDIA_EVENT_TYPE
@@ -157,6 +157,13 @@ public:
         bool isForReport = false,
         uint32_t option = MEDIA_USER_SETTING_INTERNAL);
 
+    //!
+    //! \brief    Read all items from config path and environment variable again on next read
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if no error, otherwise will return failed reason
+    //!
+    virtual MOS_STATUS Refresh();
+
     //!
     //! \brief    Check whether the key has been registered 
     //! \param    [in] valueName
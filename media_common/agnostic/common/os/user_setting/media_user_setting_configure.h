@@ -28,6 +28,8 @@
 #define __MEDIA_USER_SETTING_CONFIGURE__H__
 
 #include <string>
+#include <vector>
+#include <memory>
 #include "media_user_setting_definition.h"
 #include "mos_utilities.h"
 
@@ -134,6 +136,15 @@ public:
         bool isForReport,
         uint32_t option = MEDIA_USER_SETTING_INTERNAL);
 
+    //!
+    //! \brief    Drop the resolved values of all items
+    //! \details  Internal items are read from config path and environment variable only once,
+    //!           call this when they are changed outside of the driver to read them again.
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if no error, otherwise will return failed reason
+    //!
+    MOS_STATUS Refresh();
+
     //!
     //! \brief    Get the report path of the key
     //! \return   std::string
@@ -201,22 +212,67 @@ protected:
 
     //!
     //! \brief    Get hash value of specific string
+    //! \details  FNV-1a, so that names known at compile time can be hashed as constant expressions
     //! \param    [in] str
     //!           Input string
+    //! \param    [in] len
+    //!           Length of the input string
     //! \return   size_t
     //!           Hash value
     //!
-    size_t MakeHash(const std::string &str)
+    static constexpr size_t MakeHash(const char *str, size_t len)
     {
-        std::hash<std::string> HashFunc;
-        return HashFunc(str);
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < len; i++)
+        {
+            hash = (hash ^ (uint8_t)str[i]) * 0x100000001b3ull;
+        }
+        return (size_t)hash;
     }
 
+    //!
+    //! \brief    Get hash value of specific string
+    //! \param    [in] str
+    //!           Input string
+    //! \return   size_t
+    //!           Hash value
+    //!
+    static size_t MakeHash(const std::string &str)
+    {
+        return MakeHash(str.data(), str.size());
+    }
+
+    //!
+    //! \brief    Get the definition of specific item without inserting it
+    //! \param    [in] itemName
+    //!           Name of the item
+    //! \param    [in] group
+    //!           Group of the item
+    //! \return   std::shared_ptr<Definition>
+    //!           The definition, nullptr if the item is not registered
+    //!
+    std::shared_ptr<Definition> GetDefinition(const std::string &itemName, const Group &group)
+    {
+        auto &defs = GetDefinitions(group);
+        auto it = defs.find(MakeHash(itemName));
+        return it == defs.end() ? nullptr : it->second;
+    }
+
+    //!
+    //! \brief    Read internal item from config path and environment variable, and publish the result
+    //! \param    [in] def
+    //!           Definition of the item
+    //! \return   const Definition::Resolved *
+    //!           The published result
+    //!
+    const Definition::Resolved *Resolve(std::shared_ptr<Definition> def);
+
     const uint32_t GetRegAccessDataType(MOS_USER_FEATURE_VALUE_TYPE type);
 
 protected:
     MosMutex m_mutexLock; //!< mutex for protecting definitions
     Definitions m_definitions[Group::MaxCount]{}; //!< definitions of media user setting
+    std::vector<std::unique_ptr<Definition::Resolved>> m_resolvedPool{}; //!< resolved values published to definitions
     bool m_isDebugMode = false; //!< whether in debug/release-internal mode
     RegBufferMap m_regBufferMap{};
     MOS_USER_FEATURE_KEY_PATH_INFO *m_keyPathInfo = nullptr;
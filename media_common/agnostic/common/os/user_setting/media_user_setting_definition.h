@@ -30,6 +30,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <atomic>
 #include <iosfwd>
 #include "mos_defs_specific.h"
 #include "media_user_setting_value.h"
@@ -58,6 +59,15 @@ namespace Internal {
 class Definition
 {
 public:
+    //!
+    //! \brief    Resolved read result of the item, immutable once published
+    //!
+    struct Resolved
+    {
+        MOS_STATUS status;  //!< Read status of config path and environment variable
+        Value      value;   //!< Value read, only valid when status is success
+    };
+
     //!
     //! \brief    Constructor
     //! \param    [in] itemName
@@ -156,7 +166,61 @@ public:
     //!           the custom path
     //!
     bool UseStatePath() const { return m_statePath; }
+
+    //!
+    //! \brief    Get the published read result of the item
+    //! \return   const Resolved *
+    //!           the read result, nullptr if the item has not been resolved
+    //!
+    const Resolved *GetResolved() const { return m_resolved.load(std::memory_order_acquire); }
+
+    //!
+    //! \brief    Publish the read result of the item
+    //! \param    [in] resolved
+    //!           The read result, owned by the caller and kept alive until the definition is released
+    //!
+    void SetResolved(const Resolved *resolved) { m_resolved.store(resolved, std::memory_order_release); }
+
+    //!
+    //! \brief    Check whether the value is the same as the last reported one
+    //! \param    [in] value
+    //!           The value to report
+    //! \return   bool
+    //!           true if the same numeric value has been reported already
+    //!
+    bool IsLastReported(const Value &value) const
+    {
+        return IsNumericReport(value) &&
+               m_reported.load(std::memory_order_acquire) &&
+               m_lastReported.load(std::memory_order_relaxed) == value.Get<unsigned long long>();
+    }
+
+    //!
+    //! \brief    Save the last reported value, must be called with the report write
+    //! \param    [in] value
+    //!           The value reported
+    //!
+    void SetLastReported(const Value &value)
+    {
+        if (!IsNumericReport(value))
+        {
+            m_reported.store(false, std::memory_order_release);
+            return;
+        }
+        m_lastReported.store(value.Get<unsigned long long>(), std::memory_order_relaxed);
+        m_reported.store(true, std::memory_order_release);
+    }
 private:
+    //!
+    //! \brief    Whether the reported value is numeric and of the registered type
+    //!
+    bool IsNumericReport(const Value &value) const
+    {
+        return value.ValueType() == m_defaultValue.ValueType() &&
+               value.ValueType() >= MOS_USER_FEATURE_VALUE_TYPE_BOOL &&
+               value.ValueType() <= MOS_USER_FEATURE_VALUE_TYPE_FLOAT;
+    }
+
     //!
     //! \brief    Set the values of definition
     //! \param    [in] Definition
@@ -173,6 +237,9 @@ private:
     std::string m_subPath{};    //!< custome path is a relative path, it could be null
     UFKEY_NEXT m_rootKey{};    //!< root key
     bool m_statePath      = true;    //!< Whether the item read from a specific path
+    std::atomic<const Resolved *> m_resolved{nullptr};  //!< Read result published by configure
+    std::atomic<unsigned long long> m_lastReported{0};  //!< Raw numeric value last reported
+    std::atomic<bool> m_reported{false};                //!< Whether m_lastReported is valid
 };
 
 using Definitions = std::map<std::size_t, std::shared_ptr<Definition>>;
@@ -762,6 +762,7 @@ typedef struct _RENDERHAL_KRN_ALLOCATION
     Kdll_CacheEntry             *pKernelEntry;                                  // Pointer to Kernel entry for VP/KDLL
     RENDERHAL_CLONE_KERNEL_PARAM cloneKernelParams;                             // CM - Clone kernel information
     int32_t                 iAllocIndex;                                        // Kernel allocation index (index in kernel allocation table)
+    uint32_t                dwUseCount;                                         // Kernel uses since load, halved on each eviction scan
 
     // DSH - Dynamic list of kernel allocations
     PMHW_STATE_HEAP_MEMORY_BLOCK pMemoryBlock;                                  // Memory block in ISH
@@ -949,6 +950,8 @@ typedef struct _RENDERHAL_STATE_HEAP
     uint8_t                 *pKernelLoadMap;                                     // Kernel load map
     uint32_t                dwAccessCounter;                                    // Incremented when a kernel is loaded/used, for dynamic allocation
     int32_t                 iKernelUsedForDump;                                 // The kernel size to be dumped in oca buffer.
+    uint32_t                dwKernelLoads;                                      // Number of kernels written to ISH
+    uint32_t                dwKernelEvictions;                                  // Number of kernels evicted to make space in ISH
 
     // Kernel Spill Area
     uint32_t                dwScratchSpaceSize;                                 // Size of the Scratch Area
@@ -1062,6 +1065,34 @@ typedef struct _RENDERHAL_SURFACE_STATE_ENTRY
     uint16_t                        wVYOffset;                                      //
 } RENDERHAL_SURFACE_STATE_ENTRY, *PRENDERHAL_SURFACE_STATE_ENTRY;
 
+//!
+//! Structure RENDERHAL_SURFACE_STATE_CACHE
+//! \brief Surface states set up in the current SSH instance; binding the same surface
+//!        with the same params again reuses the entries instead of rewriting them
+//!
+#define RENDERHAL_SURFACE_STATE_CACHE_SIZE  16
+
+typedef struct _RENDERHAL_SURFACE_STATE_CACHE_ENTRY
+{
+    RENDERHAL_SURFACE               SurfaceIn;                                  // Surface passed to setup
+    RENDERHAL_SURFACE_STATE_PARAMS  ParamsIn;                                   // Params passed to setup (cache policy resolved)
+    RENDERHAL_OFFSET_OVERRIDE       OffsetOverride;                             // Offset override passed to setup
+    bool                            bOffsetOverride;                            // Offset override is used
+    RENDERHAL_SURFACE               SurfaceOut;                                 // Surface after setup
+    RENDERHAL_SURFACE_STATE_PARAMS  ParamsOut;                                  // Params after setup
+    int32_t                         iNumEntries;                                // Number of surface state entries
+    int32_t                         iSurfStateID[MHW_MAX_SURFACE_PLANES];       // Surface state entry IDs in SSH instance
+} RENDERHAL_SURFACE_STATE_CACHE_ENTRY, *PRENDERHAL_SURFACE_STATE_CACHE_ENTRY;
+
+typedef struct _RENDERHAL_SURFACE_STATE_CACHE
+{
+    int32_t                             iCount;                                 // Valid entries
+    int32_t                             iNext;                                  // Next entry to replace when full
+    uint32_t                            dwLookups;                              // Lookups in current SSH instance
+    uint32_t                            dwHits;                                 // Hits in current SSH instance
+    RENDERHAL_SURFACE_STATE_CACHE_ENTRY Entries[RENDERHAL_SURFACE_STATE_CACHE_SIZE];
+} RENDERHAL_SURFACE_STATE_CACHE, *PRENDERHAL_SURFACE_STATE_CACHE;
+
 //!
 // \brief   Helper parameters used by Mhw_SendGenericPrologCmd and to initiate command buffer attributes
 //!
@@ -1274,6 +1305,7 @@ typedef struct _RENDERHAL_INTERFACE
     uint32_t                    oldCacheSettingForTargetSurface = 0;
 #endif
 
+    PRENDERHAL_SURFACE_STATE_CACHE pSurfaceStateCache = nullptr; //!< Surface states reusable in current SSH instance
     MediaPerfProfiler           *pPerfProfiler = nullptr; //!< Performance data profiler
     bool                        eufusionBypass = false;
     MediaUserSettingSharedPtr   userSettingPtr = nullptr; //!< Shared pointer to User Setting instance
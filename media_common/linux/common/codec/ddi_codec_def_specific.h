@@ -206,6 +206,8 @@ typedef struct _DDI_CODEC_COM_BUFFER_MGR
     int32_t                                     *pNumOfRenderedSliceParaForOneBuffer; // how many slice headers in one slice parameter buffer.
     int32_t                                     *pRenderedOrder; // a array to keep record the sequence when slice data rendered.
     bool                                         bIsSliceOverSize;
+    uint32_t                                     dwMaxFrameSliceDataSize; // decaying peak of the total slice data size per frame, used to size the bitstream buffer up front
+    uint32_t                                     dwFrameSliceDataSize; // total slice data size of the current frame
     //decode parameters
     union
     {
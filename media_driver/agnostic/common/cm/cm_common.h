@@ -401,8 +401,9 @@ typedef enum _CM_RETURN_CODE
 #define CM_DDI_6_0 600
 #define CM_DDI_7_0 700
 #define CM_DDI_7_2 702 //for MDFRT API refreshment.
+#define CM_DDI_7_3 703 //for CmQueue::GetEventCompletionFd
 
-#define CM_VERSION (CM_DDI_7_2)
+#define CM_VERSION (CM_DDI_7_3)
 
 #define CM_BUFFER_STATELESS_CREATE_OPTION_GFX_MEM 0
 #define CM_BUFFER_STATELESS_CREATE_OPTION_SYS_MEM 1
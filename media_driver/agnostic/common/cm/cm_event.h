@@ -184,6 +184,23 @@ public:
     //!
     CM_RT_API virtual int32_t GetExecutionTickTime(uint64_t &ticks) = 0;
 
+    //!
+    //! \brief      Get a file descriptor which is signaled when the task
+    //!             associated with the event finishes execution on GPU.
+    //! \details    The descriptor is a fence exported from the kernel driver,
+    //!             it becomes readable when the task finishes. It can be added
+    //!             to the poll/epoll loop of application to get notified of
+    //!             task completion without polling the event. The task is
+    //!             flushed if it is still queued. The caller owns the
+    //!             descriptor and must close it.
+    //! \param      [out] fd
+    //!             Reference to the file descriptor, -1 if failed.
+    //! \retval     CM_SUCCESS if the descriptor is successfully returned.
+    //! \retval     CM_NOT_IMPLEMENTED if fence export is not supported by OS
+    //!             or kernel driver.
+    //!
+    CM_RT_API virtual int32_t GetCompletionFd(int32_t &fd) = 0;
+
 };
 }; //namespace
 
@@ -52,6 +52,12 @@ public:
 
     virtual int32_t GetExecutionTickTime(uint64_t &ticks);
 
+    virtual int32_t GetCompletionFd(int32_t &fd)
+    {
+        fd = -1;
+        return CM_NOT_IMPLEMENTED;
+    }
+
     void SetNotifier(CMRT_UMD::CmNotifierGroup *notifier) {m_notifier = notifier; }
 
 protected:
@@ -79,6 +79,10 @@ public:
 
     CM_RT_API int32_t GetExecutionTickTime(uint64_t &ticks);
 
+    CM_RT_API int32_t GetCompletionFd(int32_t &fd);
+
+    int32_t WaitForFence(uint32_t timeOutMs);
+
     int32_t GetIndex(uint32_t &index);
 
     int32_t SetTaskDriverId(int32_t id);
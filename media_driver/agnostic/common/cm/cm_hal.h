@@ -1886,6 +1886,11 @@ typedef struct _CM_HAL_STATE
         PCM_HAL_STATE     state,
         uint32_t          sync);
 
+    MOS_STATUS (*pfnExportTaskFence)(
+        PCM_HAL_STATE     state,
+        void              *osData,
+        int32_t           *fenceFd);
+
     MOS_STATUS (*pfnSurfaceSync)(
         PCM_HAL_STATE     pState,
         PMOS_SURFACE      pSurface,
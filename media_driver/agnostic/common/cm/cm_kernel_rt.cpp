@@ -2720,7 +2720,7 @@ int32_t CmKernelRT::CreateThreadArgData(
             CM_THREAD_SPACE_UNIT *threadSpaceUnit = nullptr;
             threadSpace->GetThreadSpaceUnit(threadSpaceUnit);
 
-            uint32_t *boardOrder = nullptr;
+            const uint32_t *boardOrder = nullptr;
             threadSpace->GetBoardOrder(boardOrder);
 
             for (uint32_t index = 0; index < threadArgCount; index++)
@@ -3155,7 +3155,7 @@ int32_t CmKernelRT::CreateThreadSpaceParam(
         CM_CHK_NULL_GOTOFINISH(kernelThreadSpaceParam->threadCoordinates , CM_OUT_OF_HOST_MEMORY);
         CmSafeMemSet(kernelThreadSpaceParam->threadCoordinates, 0, threadSpaceHeight * threadSpaceWidth * sizeof(CM_HAL_SCOREBOARD));
 
-        uint32_t *boardOrder = nullptr;
+        const uint32_t *boardOrder = nullptr;
         threadSpace->GetBoardOrder(boardOrder);
         CM_CHK_NULL_GOTOFINISH_CMERROR(boardOrder);
 
@@ -4544,7 +4544,7 @@ int32_t CmKernelRT::UpdateKernelData(
 
         if(m_threadSpace->IsThreadAssociated())
         {// media object only
-            uint32_t *boardOrder = nullptr;
+            const uint32_t *boardOrder = nullptr;
             m_threadSpace->GetBoardOrder(boardOrder);
             CM_CHK_NULL_GOTOFINISH_CMERROR(boardOrder);
 
@@ -24,29 +24,201 @@
 //! \brief     Contains CM memory function implementations 
 //!
 
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
 #include "cm_mem.h"
 #include "cm_mem_c_impl.h"
 #include "cm_mem_sse2_impl.h"
+#include "cm_mem_avx2_impl.h"
+#include "cm_mem_avx512_impl.h"
 
 typedef void(*t_CmFastMemCopy)( void* dst, const   void* src, const size_t bytes );
 typedef void(*t_CmFastMemCopyWC)( void* dst,   const void* src, const size_t bytes );
 
 #define CM_FAST_MEM_COPY_CPU_INIT_C(func)       (func ## _C)
 #define CM_FAST_MEM_COPY_CPU_INIT_SSE2(func)    (func ## _SSE2)
-#define CM_FAST_MEM_COPY_CPU_INIT(func)         (is_SSE2_available ? CM_FAST_MEM_COPY_CPU_INIT_SSE2(func) : CM_FAST_MEM_COPY_CPU_INIT_C(func))
+#define CM_FAST_MEM_COPY_CPU_INIT_AVX2(func)    (func ## _AVX2)
+#define CM_FAST_MEM_COPY_CPU_INIT_AVX512(func)  (func ## _AVX512)
+#define CM_FAST_MEM_COPY_CPU_INIT(func, level)                                                          \
+    ((level) >= CPU_INSTRUCTION_LEVEL_AVX512 ? CM_FAST_MEM_COPY_CPU_INIT_AVX512(func) :                 \
+     (level) >= CPU_INSTRUCTION_LEVEL_AVX2   ? CM_FAST_MEM_COPY_CPU_INIT_AVX2(func)   :                 \
+     (level) >= CPU_INSTRUCTION_LEVEL_SSE2   ? CM_FAST_MEM_COPY_CPU_INIT_SSE2(func)   :                 \
+                                               CM_FAST_MEM_COPY_CPU_INIT_C(func))
+
+/*****************************************************************************\
+Class:
+    CmFastMemCopyThreadPool
+
+Description:
+    Persistent workers for large copies. A copy is split into cacheline aligned
+    chunks; the calling thread copies the first chunk and the workers the rest.
+    Each chunk is fenced by the copy function, and waiting for the workers under
+    the pool mutex orders their stores before return.
+
+    Workers are created once per process. If no worker can be created, or the
+    pool is busy with a copy from another thread, Copy returns false and the
+    caller copies single-threaded.
+\*****************************************************************************/
+class CmFastMemCopyThreadPool
+{
+public:
+    static CmFastMemCopyThreadPool &GetInstance()
+    {
+        static CmFastMemCopyThreadPool pool;
+        return pool;
+    }
+
+    bool Copy( t_CmFastMemCopy copyFunc, void* dst, const void* src, const size_t bytes )
+    {
+        std::unique_lock<std::mutex> copyLock(m_copyMutex, std::try_to_lock);
+        if( !copyLock.owns_lock() || m_workers.empty() )
+        {
+            return false;
+        }
+
+        uint8_t       *cacheDst   = (uint8_t*)dst;
+        const uint8_t *cacheSrc   = (const uint8_t*)src;
+        const size_t   chunkCount = m_workers.size() + 1;
+        const size_t   chunkSize  = MOS_ALIGN_CEIL((bytes + chunkCount - 1) / chunkCount, sizeof(CACHELINE) * 2);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for( size_t i = 0; i < m_workers.size(); i++ )
+            {
+                const size_t offset = (i + 1) * chunkSize;
+                m_chunks[i].dst   = cacheDst + offset;
+                m_chunks[i].src   = cacheSrc + offset;
+                m_chunks[i].bytes = offset < bytes ? MOS_MIN(chunkSize, bytes - offset) : 0;
+            }
+            m_copyFunc = copyFunc;
+            m_pending  = (uint32_t)m_workers.size();
+            m_generation++;
+        }
+        m_workCond.notify_all();
+
+        copyFunc(cacheDst, cacheSrc, MOS_MIN(chunkSize, bytes));
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCond.wait(lock, [this] { return m_pending == 0; });
+        return true;
+    }
+
+private:
+    struct Chunk
+    {
+        void       *dst   = nullptr;
+        const void *src   = nullptr;
+        size_t      bytes = 0;
+    };
+
+    CmFastMemCopyThreadPool()
+    {
+        const uint32_t threadCount = MOS_MIN(std::thread::hardware_concurrency(), (uint32_t)CM_CPU_FASTCOPY_MT_MAX_THREADS);
+        if( threadCount <= 1 )
+        {
+            return;
+        }
+
+        m_chunks.resize(threadCount - 1);
+        for( uint32_t i = 0; i < threadCount - 1; i++ )
+        {
+            try
+            {
+                m_workers.emplace_back(&CmFastMemCopyThreadPool::WorkerProc, this, i);
+            }
+            catch( const std::system_error &e )
+            {
+                // Keep the workers created so far, none means single-threaded copies
+                CM_NORMALMESSAGE("Failed to create fast copy worker %d: %s", i, e.what());
+                break;
+            }
+        }
+    }
+
+    ~CmFastMemCopyThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_workCond.notify_all();
+
+        for( auto &worker : m_workers )
+        {
+            worker.join();
+        }
+    }
+
+    void WorkerProc( uint32_t index )
+    {
+        uint64_t generation = 0;
+
+        while( true )
+        {
+            Chunk           chunk;
+            t_CmFastMemCopy copyFunc = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workCond.wait(lock, [&] { return m_stop || m_generation != generation; });
+                if( m_stop )
+                {
+                    return;
+                }
+                generation = m_generation;
+                chunk      = m_chunks[index];
+                copyFunc   = m_copyFunc;
+            }
+
+            if( chunk.bytes )
+            {
+                copyFunc(chunk.dst, chunk.src, chunk.bytes);
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if( --m_pending == 0 )
+            {
+                m_doneCond.notify_one();
+            }
+        }
+    }
+
+    std::mutex               m_copyMutex;           // one multi-threaded copy at a time
+    std::mutex               m_mutex;               // protects the fields below
+    std::condition_variable  m_workCond;
+    std::condition_variable  m_doneCond;
+    std::vector<Chunk>       m_chunks;              // chunk of the current copy for each worker
+    t_CmFastMemCopy          m_copyFunc   = nullptr;
+    uint64_t                 m_generation = 0;      // bumped for every copy handed to the workers
+    uint32_t                 m_pending    = 0;      // workers still copying the current generation
+    bool                     m_stop       = false;
+    std::vector<std::thread> m_workers;             // declared last, started once the state above exists
+};
 
 void CmFastMemCopy( void* dst, const void* src, const size_t bytes )
 {
-    static const bool is_SSE2_available = (GetCpuInstructionLevel() >= CPU_INSTRUCTION_LEVEL_SSE2);
-    static const t_CmFastMemCopy CmFastMemCopy_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopy);
+    static const t_CmFastMemCopy CmFastMemCopy_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopy, GetCpuInstructionLevel());
+
+    if( bytes >= CM_CPU_FASTCOPY_MT_THRESHOLD &&
+        CmFastMemCopyThreadPool::GetInstance().Copy(CmFastMemCopy_impl, dst, src, bytes) )
+    {
+        return;
+    }
 
     CmFastMemCopy_impl(dst, src, bytes);
 }
 
 void CmFastMemCopyWC( void* dst, const void* src, const size_t bytes )
 {
-    static const bool is_SSE2_available = (GetCpuInstructionLevel() >= CPU_INSTRUCTION_LEVEL_SSE2);
-    static const t_CmFastMemCopyWC CmFastMemCopyWC_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopyWC);
+    static const t_CmFastMemCopyWC CmFastMemCopyWC_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopyWC, GetCpuInstructionLevel());
+
+    if( bytes >= CM_CPU_FASTCOPY_MT_THRESHOLD &&
+        CmFastMemCopyThreadPool::GetInstance().Copy(CmFastMemCopyWC_impl, dst, src, bytes) )
+    {
+        return;
+    }
 
     CmFastMemCopyWC_impl(dst, src, bytes);
 }
@@ -40,6 +40,8 @@ enum CPU_INSTRUCTION_LEVEL
     CPU_INSTRUCTION_LEVEL_SSE3,
     CPU_INSTRUCTION_LEVEL_SSE4,
     CPU_INSTRUCTION_LEVEL_SSE4_1,
+    CPU_INSTRUCTION_LEVEL_AVX2,
+    CPU_INSTRUCTION_LEVEL_AVX512,
     NUM_CPU_INSTRUCTION_LEVELS
 };
 
@@ -215,25 +217,42 @@ inline int CmSafeMemCompare( const void* dst, const void* src, const size_t byte
 
 /*****************************************************************************\
 Inline Function:
-    GetCpuInstructionLevel
+    DetectCpuInstructionLevel
 
 Description:
-    Returns the highest level of IA32 intruction extensions supported by the CPU
-    ( i.e. SSE, SSE2, SSE4, etc )
+    Queries the CPU for the highest level of IA32 intruction extensions supported
+    ( i.e. SSE, SSE2, SSE4, AVX2, etc ). AVX2 and AVX-512 are only reported when
+    the OS has enabled the corresponding register state in XCR0.
 
 Output:
     CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
     by CPU
 \*****************************************************************************/
-inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+inline CPU_INSTRUCTION_LEVEL DetectCpuInstructionLevel( void )
 {
     int cpuInfo[4];
+    int extCpuInfo[4];
     memset( cpuInfo, 0, 4*sizeof(int) );
+    memset( extCpuInfo, 0, 4*sizeof(int) );
 
     GetCPUID(cpuInfo, 1);
+    GetCPUIDEx(extCpuInfo, 7, 0);
+
+    // XGETBV is only valid when OSXSAVE is set
+    const uint64_t xcr0 = ( cpuInfo[2] & BIT(27) ) ? GetXCR0() : 0;
+    const bool isAvxStateEnabled    = ( xcr0 & 0x6 ) == 0x6;     // XMM | YMM
+    const bool isAvx512StateEnabled = ( xcr0 & 0xE6 ) == 0xE6;   // XMM | YMM | OPMASK | ZMM
 
     CPU_INSTRUCTION_LEVEL cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_UNKNOWN;
-    if( (cpuInfo[2] & BIT(19)) && TestSSE4_1() )
+    if( isAvx512StateEnabled && (extCpuInfo[1] & BIT(16)) && (extCpuInfo[1] & BIT(5)) )
+    {
+        cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_AVX512;
+    }
+    else if( isAvxStateEnabled && (extCpuInfo[1] & BIT(5)) )
+    {
+        cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_AVX2;
+    }
+    else if( (cpuInfo[2] & BIT(19)) && TestSSE4_1() )
     {
         cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_SSE4_1;
     }
@@ -257,6 +276,25 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     return cpuInstructionLevel;
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCpuInstructionLevel
+
+Description:
+    Returns the highest level of IA32 intruction extensions supported by the CPU.
+    CPUID is only executed once per process since callers query the level on
+    every surface copy.
+
+Output:
+    CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
+    by CPU
+\*****************************************************************************/
+inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+{
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = DetectCpuInstructionLevel();
+    return cpuInstructionLevel;
+}
+
 /*****************************************************************************\
 Inline Function:
     Round
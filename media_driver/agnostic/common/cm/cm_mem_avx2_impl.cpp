@@ -0,0 +1,59 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations using AVX2
+//!
+
+#include "cm_mem_avx2_impl.h"
+
+// The whole file relies on the target flag, fail the build rather than
+// leaving the dispatcher with unresolved symbols.
+#if !defined(__AVX2__)
+#error "cm_mem_avx2_impl.cpp must be built with -mavx2"
+#endif
+
+#include "cm_mem_avx_copy.h"
+
+namespace
+{
+
+struct CmAVX2Ops
+{
+    typedef __m256i Vector;
+
+    static Vector Load( const void* src )         { return _mm256_loadu_si256( (const __m256i*)src ); }
+    static void Store( void* dst, Vector data )   { _mm256_storeu_si256( (__m256i*)dst, data ); }
+    static void Stream( void* dst, Vector data )  { _mm256_stream_si256( (__m256i*)dst, data ); }
+};
+
+} // namespace
+
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    CmFastMemCopyAvx<CmAVX2Ops, false>( dst, src, bytes );
+}
+
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    CmFastMemCopyAvx<CmAVX2Ops, true>( dst, src, bytes );
+}
@@ -0,0 +1,59 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.h
+//! \brief     Contains CM memory function definitions using AVX2
+//!
+#pragma once
+
+#include <stddef.h>
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopy_AVX2
+
+Description:
+    Memory Copy function using 256-bit Advanced Vector Extensions 2 for large
+    amounts of data. Destination is regular cacheable memory.
+
+Input:
+    dst - pointer to destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes );
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopyWC_AVX2
+
+Description:
+    Memory Copy function using 256-bit Advanced Vector Extensions 2 for large
+    amounts of data written to write-combined memory. Uses streaming stores
+    followed by a store fence.
+
+Input:
+    dst - pointer to write-combined destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes );
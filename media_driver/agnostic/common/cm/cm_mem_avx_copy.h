@@ -0,0 +1,160 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx_copy.h
+//! \brief     Contains the CM memory copy body shared by the AVX2 and AVX-512 implementations
+//!
+//! Only included by the translation units built with -mavx2 or -mavx512f. Everything
+//! here has internal linkage, and the file must not include cm_mem.h or any other
+//! header with inline functions: those would be emitted as COMDAT built with AVX
+//! instructions, and the linker may keep that copy for callers running on CPUs
+//! without AVX.
+//!
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <immintrin.h>
+
+namespace
+{
+
+const size_t cmAvxCachelineSize       = 64;
+const size_t cmAvxVectorsPerIteration = 4;
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopyAvx
+
+Description:
+    Memory Copy function for large amounts of data using the vector operations
+    provided by Ops (Vector type, Load, Store and Stream). With streaming set,
+    the destination is aligned to the vector size and written with streaming
+    stores followed by a store fence, for write-combined memory.
+
+Input:
+    dst - pointer to destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+template <class Ops, bool streaming>
+void CmFastMemCopyAvx( void* dst, const void* src, const size_t bytes )
+{
+    const size_t vectorSize        = sizeof(typename Ops::Vector);
+    const size_t bytesPerIteration = vectorSize * cmAvxVectorsPerIteration;
+
+    // Cache pointers to memory
+    uint8_t       *cacheDst = (uint8_t*)dst;
+    const uint8_t *cacheSrc = (const uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= bytesPerIteration )
+    {
+        // The destination pointer should be vector aligned for streaming stores
+        const size_t alignBytes = streaming ?
+            ( vectorSize - ( (uintptr_t)cacheDst & ( vectorSize - 1 ) ) ) & ( vectorSize - 1 ) : 0;
+        if( alignBytes )
+        {
+            memcpy( cacheDst, cacheSrc, alignBytes );
+
+            cacheDst += alignBytes;
+            cacheSrc += alignBytes;
+            count -= alignBytes;
+        }
+
+        // Prefetch the src data
+        for( size_t i = 0; i < bytesPerIteration; i += cmAvxCachelineSize )
+        {
+            _mm_prefetch( (const char*)cacheSrc + i, _MM_HINT_NTA );
+        }
+
+        while( count >= bytesPerIteration )
+        {
+            // Prefetch the src data of the next iteration
+            for( size_t i = 0; i < bytesPerIteration; i += cmAvxCachelineSize )
+            {
+                _mm_prefetch( (const char*)cacheSrc + bytesPerIteration + i, _MM_HINT_NTA );
+            }
+
+            const typename Ops::Vector data0 = Ops::Load( cacheSrc );
+            const typename Ops::Vector data1 = Ops::Load( cacheSrc + vectorSize );
+            const typename Ops::Vector data2 = Ops::Load( cacheSrc + 2 * vectorSize );
+            const typename Ops::Vector data3 = Ops::Load( cacheSrc + 3 * vectorSize );
+
+            if( streaming )
+            {
+                // Full cachelines of streaming stores fill WC buffers without partial evictions
+                Ops::Stream( cacheDst, data0 );
+                Ops::Stream( cacheDst + vectorSize, data1 );
+                Ops::Stream( cacheDst + 2 * vectorSize, data2 );
+                Ops::Stream( cacheDst + 3 * vectorSize, data3 );
+            }
+            else
+            {
+                Ops::Store( cacheDst, data0 );
+                Ops::Store( cacheDst + vectorSize, data1 );
+                Ops::Store( cacheDst + 2 * vectorSize, data2 );
+                Ops::Store( cacheDst + 3 * vectorSize, data3 );
+            }
+
+            cacheDst += bytesPerIteration;
+            cacheSrc += bytesPerIteration;
+            count -= bytesPerIteration;
+        }
+
+        while( count >= vectorSize )
+        {
+            if( streaming )
+            {
+                Ops::Stream( cacheDst, Ops::Load( cacheSrc ) );
+            }
+            else
+            {
+                Ops::Store( cacheDst, Ops::Load( cacheSrc ) );
+            }
+
+            cacheDst += vectorSize;
+            cacheSrc += vectorSize;
+            count -= vectorSize;
+        }
+
+        if( streaming )
+        {
+            // Streaming stores are weakly ordered, make them globally visible
+            // before the data is consumed by GPU
+            _mm_sfence();
+        }
+
+        // Avoid AVX-SSE transition penalty in the callers
+        _mm256_zeroupper();
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        memcpy( cacheDst, cacheSrc, count );
+    }
+}
+
+} // namespace
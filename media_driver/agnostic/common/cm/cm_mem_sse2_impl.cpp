@@ -247,6 +247,9 @@ void CmFastMemCopy_SSE2( void* dst, const void* src, const size_t bytes )
     {
         FastMemCopy_SSE2( cacheDst, cacheSrc, doubleQuadWords );
 
+        // Streaming stores are weakly ordered, make them globally visible
+        _mm_sfence();
+
         cacheDst += doubleQuadWords * sizeof(DQWORD);
         cacheSrc += doubleQuadWords * sizeof(DQWORD);
         count -= doubleQuadWords * sizeof(DQWORD);
@@ -305,6 +308,9 @@ void CmFastMemCopyWC_SSE2( void* dst, const void* src, const size_t bytes )
           doubleQuadWords );
       }
 
+      // Streaming stores are weakly ordered, make them globally visible
+      _mm_sfence();
+
       cacheDst += doubleQuadWords * sizeof(DQWORD);
       cacheSrc += doubleQuadWords * sizeof(DQWORD);
       count -= doubleQuadWords * sizeof(DQWORD);
@@ -2616,6 +2616,48 @@ finish:
     return hr;
 }
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Block on the fence of the oldest task in flushed queue
+//|             The flushed queue is not locked during the wait. The event is
+//|             referenced instead, since the task may be popped and destroyed
+//|             by another thread meanwhile, and the event holds the batch
+//|             buffer waited on.
+//| Returns:    Result of the operation.
+//*-----------------------------------------------------------------------------
+int32_t CmQueueRT::WaitForOldestFlushedTask(uint32_t timeOutMs)
+{
+    CmEventRT *event = nullptr;
+
+    m_criticalSectionFlushedTask.Acquire();
+    if (!m_flushedTasks.IsEmpty())
+    {
+        CmTaskInternal *task = (CmTaskInternal*)m_flushedTasks.Top();
+        if (task)
+        {
+            task->GetTaskEvent(event);
+        }
+        if (event)
+        {
+            CLock eventLock(m_criticalSectionEvent);
+            event->Acquire();
+        }
+    }
+    m_criticalSectionFlushedTask.Release();
+
+    if (event == nullptr)
+    {
+        return CM_SUCCESS;
+    }
+
+    int32_t result = event->WaitForFence(timeOutMs);
+
+    // Drop the reference, it destroys the event if the task is gone already
+    CmEvent *eventBase = event;
+    DestroyEvent(eventBase);
+
+    return result;
+}
+
 //*-----------------------------------------------------------------------------
 //! This is a blocking call. It will NOT return untill
 //! all tasks in GPU and all tasks in queue finishes execution.
@@ -2688,6 +2730,8 @@ int32_t CmQueueRT::CleanQueue( )
 
     while( !m_flushedTasks.IsEmpty() && status != CM_EXCEED_MAX_TIMEOUT )
     {
+        // Sleep on the fence of the oldest task instead of spinning on its tracker
+        WaitForOldestFlushedTask(CM_MAX_TIMEOUT_MS);
         QueryFlushedTasks();
 
         LARGE_INTEGER current;
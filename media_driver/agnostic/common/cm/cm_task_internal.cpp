@@ -1184,7 +1184,7 @@ int32_t CmTaskInternal::CreateThreadSpaceData(const CmThreadSpaceRT* threadSpace
             threadSpaceRT->GetThreadSpaceSize(width, height);
             threadSpaceRT->GetThreadSpaceUnit(threadSpaceUnit);
 
-            uint32_t *boardOrder = nullptr;
+            const uint32_t *boardOrder = nullptr;
             threadSpaceRT->GetBoardOrder(boardOrder);
             for (uint32_t tIndex=0; tIndex < height*width; tIndex ++)
             {
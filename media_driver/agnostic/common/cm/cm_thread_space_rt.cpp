@@ -26,6 +26,10 @@
 
 #include "cm_thread_space_rt.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include "cm_kernel_rt.h"
 #include "cm_task_rt.h"
 #include "cm_mem.h"
@@ -96,6 +100,56 @@ static CM_DEPENDENCY waveFront26ZIGPattern =
     { 1, 0, -1, -1, -1 }
 };
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Process-wide cache of generated board orders. The order only
+//|             depends on the dependency pattern and the thread space size, so
+//|             thread spaces with the same configuration share one copy instead
+//|             of regenerating it on every dispatch pattern change.
+//*-----------------------------------------------------------------------------
+class CmBoardOrderCache
+{
+public:
+    typedef std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t> Key;
+    typedef std::shared_ptr<const CM_THREAD_SPACE_BOARD_ORDER> Entry;
+
+    static CmBoardOrderCache &GetInstance()
+    {
+        static CmBoardOrderCache instance;
+        return instance;
+    }
+
+    Entry Find(const Key &key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        return (it == m_entries.end()) ? nullptr : it->second;
+    }
+
+    void Insert(const Key &key, const Entry &entry)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.find(key) != m_entries.end())
+        {
+            return;
+        }
+        if (m_insertOrder.size() >= m_maxEntries)
+        {
+            // Entries still referenced by thread spaces stay alive via shared_ptr
+            m_entries.erase(m_insertOrder.front());
+            m_insertOrder.erase(m_insertOrder.begin());
+        }
+        m_entries[key] = entry;
+        m_insertOrder.push_back(key);
+    }
+
+private:
+    static const uint32_t m_maxEntries = 32;
+
+    std::mutex             m_mutex;
+    std::map<Key, Entry>   m_entries;
+    std::vector<Key>       m_insertOrder;
+};
+
 namespace CMRT_UMD
 {
 //*-----------------------------------------------------------------------------
@@ -984,47 +1038,129 @@ finish:
 }
 
 //*-----------------------------------------------------------------------------
-//| Purpose:    Generate Wave45 Sequence
+//| Purpose:    Build the board order cache key of current configuration
 //*-----------------------------------------------------------------------------
-int32_t CmThreadSpaceRT::Wavefront45Sequence()
+static CmBoardOrderCache::Key GetBoardOrderCacheKey(
+    CM_DEPENDENCY_PATTERN    pattern,
+    CM_26ZI_DISPATCH_PATTERN dispatchPattern26ZI,
+    uint32_t width,
+    uint32_t height,
+    uint32_t blockWidth26ZI,
+    uint32_t blockHeight26ZI)
 {
-    if ( m_currentDependencyPattern == CM_WAVEFRONT )
+    if (pattern != CM_WAVEFRONT26ZI)
+    {
+        dispatchPattern26ZI = VVERTICAL_HVERTICAL_26;
+        blockWidth26ZI      = 0;
+        blockHeight26ZI     = 0;
+    }
+    return std::make_tuple((uint32_t)pattern, (uint32_t)dispatchPattern26ZI,
+                           width, height, blockWidth26ZI, blockHeight26ZI);
+}
+
+//*-----------------------------------------------------------------------------
+//| Purpose:    Attach the cached board order of current pattern if any
+//| Returns:    true if found in cache.
+//*-----------------------------------------------------------------------------
+bool CmThreadSpaceRT::AttachCachedBoardOrder()
+{
+    CmBoardOrderCache::Key key = GetBoardOrderCacheKey(m_currentDependencyPattern,
+        m_current26ZIDispatchPattern, m_width, m_height, m_26ZIBlockWidth, m_26ZIBlockHeight);
+
+    m_sharedBoardOrder = CmBoardOrderCache::GetInstance().Find(key);
+    if (m_sharedBoardOrder == nullptr)
     {
+        return false;
+    }
+
+    if (m_currentDependencyPattern == CM_WAVEFRONT26Z)
+    {
+        CmSafeMemCopy(m_wavefront26ZDispatchInfo.numThreadsInWave,
+                      m_sharedBoardOrder->numThreadsInWave.data(),
+                      m_sharedBoardOrder->numWaves * sizeof(uint32_t));
+        m_wavefront26ZDispatchInfo.numWaves = m_sharedBoardOrder->numWaves;
+    }
+
+    return true;
+}
+
+//*-----------------------------------------------------------------------------
+//| Purpose:    Publish the board order generated in m_boardOrderList to cache
+//| Returns:    CM_SUCCESS. The order in m_boardOrderList is used if caching fails.
+//*-----------------------------------------------------------------------------
+int32_t CmThreadSpaceRT::CacheBoardOrder()
+{
+    std::shared_ptr<CM_THREAD_SPACE_BOARD_ORDER> entry;
+    try
+    {
+        entry = std::make_shared<CM_THREAD_SPACE_BOARD_ORDER>();
+        entry->boardOrder.assign(m_boardOrderList, m_boardOrderList + m_width * m_height);
+        entry->numWaves = 0;
+        if (m_currentDependencyPattern == CM_WAVEFRONT26Z)
+        {
+            entry->numWaves = m_wavefront26ZDispatchInfo.numWaves;
+            entry->numThreadsInWave.assign(m_wavefront26ZDispatchInfo.numThreadsInWave,
+                m_wavefront26ZDispatchInfo.numThreadsInWave + entry->numWaves);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        // m_boardOrderList still holds the order, just leave it uncached
+        CM_NORMALMESSAGE("Warning: Failed to allocate board order cache entry.");
+        m_sharedBoardOrder = nullptr;
         return CM_SUCCESS;
     }
-    m_currentDependencyPattern = CM_WAVEFRONT;
 
-    CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
+    CmBoardOrderCache::Key key = GetBoardOrderCacheKey(m_currentDependencyPattern,
+        m_current26ZIDispatchPattern, m_width, m_height, m_26ZIBlockWidth, m_26ZIBlockHeight);
+    CmBoardOrderCache::GetInstance().Insert(key, entry);
+    m_sharedBoardOrder = entry;
+
+    return CM_SUCCESS;
+}
+
+//*-----------------------------------------------------------------------------
+//| Purpose:    Generate the order of 45/26 degree wavefront in closed form
+//|             Every thread is dispatched after its neighbours on the previous
+//|             line, so the order is the lines x + xStep * y = c for increasing c,
+//|             each walked from top to bottom. It is the same order as tracing
+//|             the line from every unvisited thread in raster order.
+//*-----------------------------------------------------------------------------
+void CmThreadSpaceRT::DiagonalLineSequence(uint32_t xStep)
+{
+    const uint32_t lineCount = (m_width - 1) + xStep * (m_height - 1) + 1;
     m_indexInList = 0;
 
-    for (uint32_t y = 0; y < m_height; y ++)
+    for (uint32_t line = 0; line < lineCount; line ++)
     {
-        for (uint32_t x = 0; x < m_width; x ++)
+        uint32_t yStart = (line > m_width - 1) ? (line - (m_width - 1) + xStep - 1) / xStep : 0;
+        uint32_t yEnd   = MOS_MIN(m_height - 1, line / xStep);
+        for (uint32_t y = yStart; y <= yEnd; y ++)
         {
-            CM_COORDINATE tempCoordinate;
-            int32_t linearOffset = y * m_width + x;
-            if (m_boardFlag[linearOffset] == WHITE)
-            {
-                m_boardOrderList[m_indexInList ++] = linearOffset;
-                m_boardFlag[linearOffset] = BLACK;
-                tempCoordinate.x = x - 1;
-                tempCoordinate.y = y + 1;
-                while ((tempCoordinate.x >= 0) && (tempCoordinate.y >= 0) &&
-                    (tempCoordinate.x < (int32_t)m_width) && (tempCoordinate.y < (int32_t)m_height))
-                {
-                    if (m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] == WHITE)
-                    {
-                        m_boardOrderList[m_indexInList ++] = tempCoordinate.y * m_width + tempCoordinate.x;
-                        m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] = BLACK;
-                    }
-                    tempCoordinate.x = tempCoordinate.x - 1;
-                    tempCoordinate.y = tempCoordinate.y + 1;
-                }
-            }
+            m_boardOrderList[m_indexInList ++] = y * m_width + (line - xStep * y);
         }
     }
+}
 
-    return CM_SUCCESS;
+//*-----------------------------------------------------------------------------
+//| Purpose:    Generate Wave45 Sequence
+//*-----------------------------------------------------------------------------
+int32_t CmThreadSpaceRT::Wavefront45Sequence()
+{
+    if ( m_currentDependencyPattern == CM_WAVEFRONT )
+    {
+        return CM_SUCCESS;
+    }
+    m_currentDependencyPattern = CM_WAVEFRONT;
+
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
+    DiagonalLineSequence(1);
+
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1038,37 +1174,14 @@ int32_t CmThreadSpaceRT::Wavefront26Sequence()
     }
     m_currentDependencyPattern = CM_WAVEFRONT26;
 
-    CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
-    m_indexInList = 0;
-
-    for (uint32_t y = 0; y < m_height; y ++)
+    if (AttachCachedBoardOrder())
     {
-        for (uint32_t x = 0; x < m_width; x ++)
-        {
-            CM_COORDINATE tempCoordinate;
-            int32_t linearOffset = y * m_width + x;
-            if (m_boardFlag[linearOffset] == WHITE)
-            {
-                m_boardOrderList[m_indexInList ++] = linearOffset;
-                m_boardFlag[linearOffset] = BLACK;
-                tempCoordinate.x = x - 2;
-                tempCoordinate.y = y + 1;
-                while ((tempCoordinate.x >= 0) && (tempCoordinate.y >= 0) &&
-                    (tempCoordinate.x < (int32_t)m_width) && (tempCoordinate.y < (int32_t)m_height))
-                {
-                    if (m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] == WHITE)
-                    {
-                        m_boardOrderList[m_indexInList ++] = tempCoordinate.y * m_width + tempCoordinate.x;
-                        m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] = BLACK;
-                    }
-                    tempCoordinate.x = tempCoordinate.x - 2;
-                    tempCoordinate.y = tempCoordinate.y + 1;
-                }
-            }
-        }
+        return CM_SUCCESS;
     }
 
-   return CM_SUCCESS;
+    DiagonalLineSequence(2);
+
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1089,6 +1202,11 @@ int32_t CmThreadSpaceRT::Wavefront26ZSequence()
     {
         return CM_INVALID_ARG_SIZE;
     }
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
     CmSafeMemSet( m_boardFlag, WHITE, m_width * m_height * sizeof( uint32_t ) );
     m_indexInList = 0;
 
@@ -1259,7 +1377,7 @@ int32_t CmThreadSpaceRT::Wavefront26ZSequence()
 
     m_wavefront26ZDispatchInfo.numWaves = numWaves;
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1280,6 +1398,11 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVVHV26()
     m_currentDependencyPattern = CM_WAVEFRONT26ZI;
     m_current26ZIDispatchPattern = VVERTICAL_HVERTICAL_26;
 
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
     CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
     m_indexInList = 0;
 
@@ -1351,7 +1474,7 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVVHV26()
         }
     }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1372,6 +1495,11 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVVHH26()
     m_currentDependencyPattern = CM_WAVEFRONT26ZI;
     m_current26ZIDispatchPattern = VVERTICAL_HHORIZONTAL_26;
 
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
     CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
     m_indexInList = 0;
 
@@ -1445,7 +1573,7 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVVHH26()
         }
     }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1465,6 +1593,11 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVV26HH26()
     m_currentDependencyPattern = CM_WAVEFRONT26ZI;
     m_current26ZIDispatchPattern = VVERTICAL26_HHORIZONTAL26;
 
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
     CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
     m_indexInList = 0;
 
@@ -1574,7 +1707,7 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVV26HH26()
         }
      }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1594,6 +1727,11 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVV1x26HH1x26()
     m_currentDependencyPattern = CM_WAVEFRONT26ZI;
     m_current26ZIDispatchPattern = VVERTICAL1X26_HHORIZONTAL1X26;
 
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
     CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
     m_indexInList = 0;
 
@@ -1716,7 +1854,7 @@ int32_t CmThreadSpaceRT::Wavefront26ZISeqVV1x26HH1x26()
         }
     }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 int32_t CmThreadSpaceRT::VerticalSequence()
@@ -1727,36 +1865,23 @@ int32_t CmThreadSpaceRT::VerticalSequence()
     }
     m_currentDependencyPattern = CM_VERTICAL_WAVE;
 
-    CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
+
+    // Threads are dispatched column by column
     m_indexInList = 0;
 
     for (uint32_t x = 0; x < m_width; x ++)
     {
         for (uint32_t y = 0; y < m_height; y ++)
         {
-            CM_COORDINATE tempCoordinate;
-            int32_t linearOffset = y * m_width + x;
-            if (m_boardFlag[linearOffset] == WHITE)
-            {
-                m_boardOrderList[m_indexInList ++] = linearOffset;
-                m_boardFlag[linearOffset] = BLACK;
-                tempCoordinate.x = x;
-                tempCoordinate.y = y + 1;
-                while ((tempCoordinate.x >= 0) && (tempCoordinate.y >= 0) &&
-                    (tempCoordinate.x < (int32_t)m_width) && (tempCoordinate.y < (int32_t)m_height))
-                {
-                    if (m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] == WHITE)
-                    {
-                        m_boardOrderList[m_indexInList ++] = tempCoordinate.y * m_width + tempCoordinate.x;
-                        m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] = BLACK;
-                    }
-                    tempCoordinate.y = tempCoordinate.y + 1;
-                }
-            }
+            m_boardOrderList[m_indexInList ++] = y * m_width + x;
         }
     }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 int32_t CmThreadSpaceRT::HorizentalSequence()
@@ -1767,36 +1892,18 @@ int32_t CmThreadSpaceRT::HorizentalSequence()
     }
     m_currentDependencyPattern = CM_HORIZONTAL_WAVE;
 
-    CmSafeMemSet(m_boardFlag, WHITE, m_width*m_height*sizeof(uint32_t));
-    m_indexInList = 0;
+    if (AttachCachedBoardOrder())
+    {
+        return CM_SUCCESS;
+    }
 
-    for (uint32_t y = 0; y < m_height; y ++)
+    // Threads are dispatched row by row
+    for (m_indexInList = 0; m_indexInList < m_width * m_height; m_indexInList ++)
     {
-        for (uint32_t x = 0; x < m_width; x ++)
-        {
-            CM_COORDINATE tempCoordinate;
-            int32_t linearOffset = y * m_width + x;
-            if (m_boardFlag[linearOffset] == WHITE)
-            {
-                m_boardOrderList[m_indexInList ++] = linearOffset;
-                m_boardFlag[linearOffset] = BLACK;
-                tempCoordinate.x = x + 1;
-                tempCoordinate.y = y;
-                while ((tempCoordinate.x >= 0) && (tempCoordinate.y >= 0) &&
-                    (tempCoordinate.x < (int32_t)m_width) && (tempCoordinate.y < (int32_t)m_height))
-                {
-                    if (m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] == WHITE)
-                    {
-                        m_boardOrderList[m_indexInList ++] = tempCoordinate.y * m_width + tempCoordinate.x;
-                        m_boardFlag[tempCoordinate.y * m_width + tempCoordinate.x] = BLACK;
-                    }
-                    tempCoordinate.x = tempCoordinate.x + 1;
-                }
-            }
-        }
+        m_boardOrderList[m_indexInList] = m_indexInList;
     }
 
-    return CM_SUCCESS;
+    return CacheBoardOrder();
 }
 
 //*-----------------------------------------------------------------------------
@@ -1831,6 +1938,9 @@ int32_t CmThreadSpaceRT::WavefrontDependencyVectors()
             return CM_OUT_OF_HOST_MEMORY;
         }
     }
+    // Order depends on the dependency vectors, it is not shared with other thread spaces
+    m_sharedBoardOrder = nullptr;
+
     uint32_t iX, iY, nOffset;
     iX = iY = nOffset = 0;
 
@@ -1903,9 +2013,9 @@ int32_t CmThreadSpaceRT::WavefrontDependencyVectors()
 //*-----------------------------------------------------------------------------
 //| Purpose:    Get Board Order list
 //*-----------------------------------------------------------------------------
-int32_t CmThreadSpaceRT::GetBoardOrder(uint32_t *&boardOrder)
+int32_t CmThreadSpaceRT::GetBoardOrder(const uint32_t *&boardOrder)
 {
-    boardOrder = m_boardOrderList;
+    boardOrder = m_sharedBoardOrder ? m_sharedBoardOrder->boardOrder.data() : m_boardOrderList;
     return CM_SUCCESS;
 }
 
@@ -1915,7 +2025,7 @@ int32_t CmThreadSpaceRT::PrintBoardOrder()
     CM_NORMALMESSAGE("According to dependency, the score board order is:");
     for (uint32_t i = 0; i < m_height * m_width; i ++)
     {
-        CM_NORMALMESSAGE("%d->", m_boardOrderList[i]);
+        CM_NORMALMESSAGE("%d->", m_sharedBoardOrder ? m_sharedBoardOrder->boardOrder[i] : m_boardOrderList[i]);
     }
     CM_NORMALMESSAGE("NIL.");
     return 0;
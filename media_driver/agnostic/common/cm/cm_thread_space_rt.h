@@ -27,6 +27,8 @@
 #ifndef MEDIADRIVER_AGNOSTIC_COMMON_CM_CMTHREADSPACERT_H_
 #define MEDIADRIVER_AGNOSTIC_COMMON_CM_CMTHREADSPACERT_H_
 
+#include <memory>
+#include <vector>
 #include "cm_thread_space.h"
 #include "cm_hal.h"
 #include "cm_log.h"
@@ -44,6 +46,17 @@ struct CM_THREAD_SPACE_UNIT
     uint8_t subSliceDestinationSelect;
 };
 
+//!
+//! \brief    Scoreboard order generated for one thread space configuration.
+//!           Shared read-only by all thread spaces with the same configuration.
+//!
+struct CM_THREAD_SPACE_BOARD_ORDER
+{
+    std::vector<uint32_t> boardOrder;
+    std::vector<uint32_t> numThreadsInWave;   // only used by wavefront 26Z
+    uint32_t numWaves;
+};
+
 enum CM_THREAD_SPACE_DIRTY_STATUS
 {
     CM_THREAD_SPACE_CLEAN                 = 0,
@@ -141,7 +154,7 @@ public:
 
     bool IntegrityCheck(CmTaskRT *task);
 
-    int32_t GetBoardOrder(uint32_t *&boardOrder);
+    int32_t GetBoardOrder(const uint32_t *&boardOrder);
 
     int32_t Wavefront45Sequence();
 
@@ -206,6 +219,27 @@ protected:
 
     int32_t InitSwScoreBoard();
 
+    //!
+    //! \brief    Attach the board order of current dependency pattern and size
+    //!           from the process-wide cache.
+    //! \return   true if the board order is found in cache.
+    //!
+    bool AttachCachedBoardOrder();
+
+    //!
+    //! \brief    Generate the order of 45 or 26 degree wavefront.
+    //! \param    [in] xStep
+    //!           1 for 45 degree and 2 for 26 degree.
+    //!
+    void DiagonalLineSequence(uint32_t xStep);
+
+    //!
+    //! \brief    Publish the board order just generated in m_boardOrderList
+    //!           to the process-wide cache and attach it.
+    //! \return   CM_SUCCESS if succeeded.
+    //!
+    int32_t CacheBoardOrder();
+
 #ifdef _DEBUG
     int32_t PrintBoardOrder();
 #endif
@@ -234,6 +268,7 @@ protected:
     uint32_t *m_boardFlag;
     uint32_t *m_boardOrderList;
     uint32_t m_indexInList;
+    std::shared_ptr<const CM_THREAD_SPACE_BOARD_ORDER> m_sharedBoardOrder;  // overrides m_boardOrderList if set
     uint32_t m_indexInThreadSpaceArray;  // index in device's ThreadSpaceArray
 
     CM_WALKING_PATTERN m_walkingPattern;
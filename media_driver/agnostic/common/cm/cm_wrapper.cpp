@@ -599,6 +599,19 @@ int32_t CmThinExecuteInternal(CmDevice *device,
     }
         break;
 
+    case CM_FN_CMQUEUE_GETEVENTCOMPLETIONFD:
+    {
+        PCM_GETEVENTCOMPLETIONFD_PARAM cmGetCompletionFdParam;
+        cmGetCompletionFdParam = (PCM_GETEVENTCOMPLETIONFD_PARAM)(cmPrivateInputData);
+        cmEvent        = (CmEvent *)cmGetCompletionFdParam->eventHandle;
+        CM_ASSERT(cmEvent);
+
+        cmRet = cmEvent->GetCompletionFd(cmGetCompletionFdParam->fd);
+
+        cmGetCompletionFdParam->returnValue = cmRet;
+    }
+        break;
+
     case CM_FN_CMDEVICE_CREATETHREADSPACE:
         PCM_CREATETHREADSPACE_PARAM cmCreateTsParam;
         cmCreateTsParam = (PCM_CREATETHREADSPACE_PARAM)(cmPrivateInputData);
@@ -147,6 +147,14 @@ typedef struct _CM_DESTROYEVENT_PARAM
     int32_t             returnValue;           // [out]
 }CM_DESTROYEVENT_PARAM, *PCM_DESTROYEVENT_PARAM;
 
+typedef struct _CM_GETEVENTCOMPLETIONFD_PARAM
+{
+    void                *queueHandle;         // [in]
+    void                *eventHandle;         // [in]
+    int32_t             fd;                   // [out]
+    int32_t             returnValue;          // [out]
+}CM_GETEVENTCOMPLETIONFD_PARAM, *PCM_GETEVENTCOMPLETIONFD_PARAM;
+
 typedef struct _CM_CREATETHREADSPACE_PARAM
 {
     uint32_t            threadSpaceWidth;                // [in]
@@ -537,6 +545,7 @@ enum CM_FUNCTION_ID
     CM_FN_CMQUEUE_DESTROYEVENTFAST  = 0x150b,
     CM_FN_CMQUEUE_ENQUEUEWITHGROUPFAST = 0x150c,
     CM_FN_CMQUEUE_ENQUEUECOPY_BUFFER   = 0x150d,
+    CM_FN_CMQUEUE_GETEVENTCOMPLETIONFD = 0x150e,
 };
 
 //*-----------------------------------------------------------------------------
@@ -95,6 +95,20 @@ int32_t CmEventEx::GetStatus(CM_STATUS &status)
     return CM_SUCCESS;
 }
 
+int32_t CmEventEx::GetCompletionFd(int32_t &fd)
+{
+    fd = -1;
+    CM_CHK_NULL_RETURN_CMERROR(m_osData);
+    if (m_cmhal->pfnExportTaskFence == nullptr)
+    {
+        return CM_NOT_IMPLEMENTED;
+    }
+    if (m_cmhal->pfnExportTaskFence(m_cmhal, m_osData, &fd) != MOS_STATUS_SUCCESS)
+    {
+        return CM_NOT_IMPLEMENTED;
+    }
+    return CM_SUCCESS;
+}
 
 void CmEventEx::RleaseOsData()
 {
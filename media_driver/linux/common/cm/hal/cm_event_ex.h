@@ -42,6 +42,8 @@ public:
 
     virtual int32_t GetStatus(CM_STATUS &status);
 
+    virtual int32_t GetCompletionFd(int32_t &fd);
+
     void SetTaskOsData(MOS_RESOURCE *resource, HANDLE handle);
 
 protected:
@@ -26,6 +26,7 @@
 
 #include "cm_event_rt.h"
 #include "cm_queue_rt.h"
+#include "cm_device_rt.h"
 
 namespace CMRT_UMD
 {
@@ -92,10 +93,9 @@ CM_RT_API int32_t CmEventRT::WaitForTaskFinished(uint32_t timeOutMs)
     CM_ASSERT(m_osData != nullptr);
 
     //Wait bo finished
-    result = mos_bo_wait((MOS_LINUX_BO*)m_osData, 1000000LL*timeOutMs);
-    mos_bo_clear_relocs((MOS_LINUX_BO*)m_osData, 0);
-    if (result) {
-        result = CM_EXCEED_MAX_TIMEOUT;   //translate the drm ecode (-ETIME or potentional variants) to CM ecode.
+    result = WaitForFence(timeOutMs);
+    if (result != CM_SUCCESS)
+    {
         goto finish;
     }
 
@@ -117,6 +117,61 @@ finish:
     return result;
 }
 
+//*-----------------------------------------------------------------------------
+//! Block on the kernel fence of the task's batch buffer.
+//! It does not query or update the event status.
+//! INPUT:
+//!     Timeout in Milliseconds
+//! OUTPUT:
+//!     CM_SUCCESS:  if the fence is signaled
+//!     CM_EXCEED_MAX_TIMEOUT:  if timeout in synchoinization system call.
+//*-----------------------------------------------------------------------------
+int32_t CmEventRT::WaitForFence(uint32_t timeOutMs)
+{
+    CM_CHK_NULL_RETURN_CMERROR(m_osData);
+
+    int result = mos_bo_wait((MOS_LINUX_BO*)m_osData, 1000000LL*timeOutMs);
+    mos_bo_clear_relocs((MOS_LINUX_BO*)m_osData, 0);
+
+    //translate the drm ecode (-ETIME or potentional variants) to CM ecode.
+    return result ? CM_EXCEED_MAX_TIMEOUT : CM_SUCCESS;
+}
+
+//*-----------------------------------------------------------------------------
+//! Get a sync_file fd which is signaled when the task finishes, so that
+//! application can wait for it in its own event loop.
+//! INPUT:
+//!     The reference to fd, caller needs to close it.
+//! OUTPUT:
+//!     CM_SUCCESS:  if the fd is exported
+//!     CM_NOT_IMPLEMENTED: if kernel doesn't support fence export.
+//*-----------------------------------------------------------------------------
+CM_RT_API int32_t CmEventRT::GetCompletionFd(int32_t &fd)
+{
+    fd = -1;
+
+    //Make sure task flushed, the fence is attached at submission
+    while ( m_status == CM_STATUS_QUEUED )
+    {
+        m_queue->FlushTaskWithoutSync();
+    }
+
+    CM_CHK_NULL_RETURN_CMERROR(m_osData);
+
+    PCM_CONTEXT_DATA cmData = (PCM_CONTEXT_DATA)m_device->GetAccelData();
+    CM_CHK_NULL_RETURN_CMERROR(cmData);
+    PCM_HAL_STATE state = cmData->cmHalState;
+    CM_CHK_NULL_RETURN_CMERROR(state);
+
+    if (state->pfnExportTaskFence == nullptr ||
+        state->pfnExportTaskFence(state, m_osData, &fd) != MOS_STATUS_SUCCESS)
+    {
+        return CM_NOT_IMPLEMENTED;
+    }
+
+    return CM_SUCCESS;
+}
+
 //*-----------------------------------------------------------------------------
 //! Unreference the bo in linux.
 //! INPUT:
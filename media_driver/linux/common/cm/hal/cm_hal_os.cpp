@@ -30,6 +30,8 @@
 #include "mos_graphicsresource.h"
 #include "mos_utilities.h"
 #include "mos_bufmgr_api.h"
+#include <linux/dma-buf.h>
+#include <sys/ioctl.h>
 
 #define Y_TILE_WIDTH  128
 #define Y_TILE_HEIGHT 32
@@ -716,6 +718,51 @@ finish:
     return eStatus;
 }
 
+//*-----------------------------------------------------------------------------
+// Purpose: Export the fences on the batch buffer of a task as a sync_file fd
+// Returns: Result of the operation
+//*-----------------------------------------------------------------------------
+MOS_STATUS HalCm_ExportTaskFence(
+    PCM_HAL_STATE                           state,
+    void                                    *osData,
+    int32_t                                 *fenceFd)
+{
+    MOS_UNUSED(state);
+    CM_CHK_NULL_RETURN_MOSERROR(osData);
+    CM_CHK_NULL_RETURN_MOSERROR(fenceFd);
+    *fenceFd = -1;
+
+#ifdef DMA_BUF_IOCTL_EXPORT_SYNC_FILE
+    int primeFd = -1;
+    if (mos_bo_export_to_prime((MOS_LINUX_BO *)osData, &primeFd) != 0)
+    {
+        return MOS_STATUS_UNIMPLEMENTED;
+    }
+
+    // GPU only reads the batch buffer, ask for write access to get all fences on it
+    struct dma_buf_export_sync_file exportSyncFile;
+    MOS_ZeroMemory(&exportSyncFile, sizeof(exportSyncFile));
+    exportSyncFile.flags = DMA_BUF_SYNC_WRITE;
+    exportSyncFile.fd    = -1;
+
+    int ret = 0;
+    do
+    {
+        ret = ioctl(primeFd, DMA_BUF_IOCTL_EXPORT_SYNC_FILE, &exportSyncFile);
+    } while (ret == -1 && (errno == EINTR || errno == EAGAIN));
+    close(primeFd);
+
+    if (ret != 0)
+    {
+        return MOS_STATUS_UNIMPLEMENTED;
+    }
+    *fenceFd = exportSyncFile.fd;
+    return MOS_STATUS_SUCCESS;
+#else
+    return MOS_STATUS_UNIMPLEMENTED;
+#endif
+}
+
 //===============<Os-dependent Private/Non-DDI Functions, Part 2>============================================
 
 //Require DRM VMAP patch,
@@ -1182,6 +1229,7 @@ void HalCm_OsInitInterface(
     cmState->pfnGetSipBinary                        = HalCm_GetSipBinary;
     cmState->pfnSurfaceSync                         = HalCm_SurfaceSync;
     cmState->pfnSyncKernel                          = HalCm_SyncKernel;
+    cmState->pfnExportTaskFence                     = HalCm_ExportTaskFence;
 
     HalCm_GetLibDrmVMapFnt(cmState);
     cmState->syncOnResource                         = false;
@@ -62,6 +62,8 @@ typedef uintptr_t           UINT_PTR;
 #endif
 
 #define CM_CPU_FASTCOPY_THRESHOLD 1024
+#define CM_CPU_FASTCOPY_MT_THRESHOLD    (4 * 1024 * 1024)   // copies larger than this are split across threads
+#define CM_CPU_FASTCOPY_MT_MAX_THREADS  4
 
 /*****************************************************************************\
 Inline Function:
@@ -137,4 +139,46 @@ inline void GetCPUID(int cpuInfo[4], int infoType)
 #endif  //NO_EXCEPTION_HANDLING
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCPUIDEx
+
+Description:
+    Retrieves cpu information and capabilities of the given sub-leaf
+Input:
+    int infoType - type of information requested
+    int subLeaf - sub-leaf of information requested
+Output:
+    int cpuInfo[4] - requested info, zeroed if the leaf is not supported
+\*****************************************************************************/
+inline void GetCPUIDEx(int cpuInfo[4], int infoType, int subLeaf)
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if ((unsigned int)infoType <= __get_cpuid_max(0, nullptr))
+    {
+        __cpuid_count(infoType, subLeaf, eax, ebx, ecx, edx);
+    }
+
+    cpuInfo[0] = (int)eax;
+    cpuInfo[1] = (int)ebx;
+    cpuInfo[2] = (int)ecx;
+    cpuInfo[3] = (int)edx;
+}
+
+/*****************************************************************************\
+Inline Function:
+    GetXCR0
+
+Description:
+    Reads XCR0 to check which register states are enabled by the OS.
+    Must only be called when CPUID reports OSXSAVE.
+\*****************************************************************************/
+inline uint64_t GetXCR0( void )
+{
+    uint32_t eax = 0, edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
 void CmFastMemCopyFromWC( void* dst, const void* src, const size_t bytes, CPU_INSTRUCTION_LEVEL cpuInstructionLevel );
@@ -7604,6 +7604,58 @@ MEDIAAPI_EXPORT VAStatus DdiMedia_MapBuffer2(
     return DdiMedia_MapBufferInternal(ctx, buf_id, pbuf, flag);
 }
 
+//!
+//! \brief  Query the slices already encoded into a coded buffer
+//! \details    libva has no call for partially coded pictures. This reports the
+//!             slices PAK has completed for the oldest pending coded buffer. A new
+//!             BRC pass encodes the picture again, slices reported with an earlier
+//!             pass index are no longer valid. The coded bytes themselves are still
+//!             only readable once vaMapBuffer returns the whole picture. Slice
+//!             progress is recorded when the "HEVC VDEnc Slice Progress Enable" user
+//!             setting is set, otherwise VA_STATUS_ERROR_UNIMPLEMENTED is returned.
+//!
+//! \param  [in] dpy
+//!         VA display
+//! \param  [in] buf_id
+//!         VA coded buffer ID
+//! \param  [out] slice_sizes
+//!         Array to receive the size in bytes of each completed slice
+//! \param  [in] max_slices
+//!         Number of entries in slice_sizes
+//! \param  [out] num_slices
+//!         Number of completed slices
+//! \param  [out] pass_index
+//!         BRC pass of the completed slices
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, else fail reason
+//!
+MEDIAAPI_EXPORT VAStatus DdiMedia_QuerySliceProgress(
+    VADisplay           dpy,
+    VABufferID          buf_id,
+    uint32_t           *slice_sizes,
+    uint32_t            max_slices,
+    uint32_t           *num_slices,
+    uint32_t           *pass_index
+)
+{
+    DDI_CHK_NULL(dpy,                     "nullptr dpy",                     VA_STATUS_ERROR_INVALID_DISPLAY);
+
+    VADriverContextP ctx = ((VADisplayContextP)dpy)->pDriverContext;
+    DDI_CHK_NULL(ctx,                     "nullptr ctx",                     VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    PDDI_MEDIA_CONTEXT mediaCtx = DdiMedia_GetMediaContext(ctx);
+    DDI_CHK_NULL(mediaCtx,               "nullptr mediaCtx",               VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    // Slice progress is only reported by the softlet encoders
+    if (!mediaCtx->m_apoDdiEnabled)
+    {
+        return VA_STATUS_ERROR_UNIMPLEMENTED;
+    }
+
+    return MediaLibvaInterfaceNext::QuerySliceProgress(ctx, buf_id, slice_sizes, max_slices, num_slices, pass_index);
+}
+
 #ifdef __cplusplus
 }
 #endif
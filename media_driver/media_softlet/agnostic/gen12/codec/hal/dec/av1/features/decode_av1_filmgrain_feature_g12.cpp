@@ -952,6 +952,8 @@ MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
     bool applyCr = (m_picParams->m_filmGrainParams.m_numCrPoints > 0 || m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_chromaScalingFromLuma) ? 1 : 0;
     m_filmGrainEnabled = m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain && (applyY | applyCb | applyCr);
 
+    m_grainTemplateReused = m_filmGrainEnabled && IsGrainTemplateReusable(m_picParams);
+
     if (m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain)
     {
         m_av1TileParams = static_cast<CodecAv1TileParams*>(decodeParams->m_sliceParams);
@@ -960,8 +962,24 @@ MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
         m_segmentParams = &m_picParams->m_av1SegData;
         DECODE_CHK_NULL(m_segmentParams);
 
-        DECODE_CHK_STATUS(SetFrameStates(m_picParams));
-        DECODE_CHK_STATUS(AllocateVariableSizeSurfaces());
+        // Keep surfaces holding previous grain templates, apply noise only reads them.
+        if (!m_grainTemplateReused)
+        {
+            // Surfaces may be reallocated below, drop the cache until new templates are generated.
+            m_grainTemplateValid = false;
+
+            DECODE_CHK_STATUS(SetFrameStates(m_picParams));
+            DECODE_CHK_STATUS(AllocateVariableSizeSurfaces());
+
+            m_grainTemplateValid = m_filmGrainEnabled;
+            if (m_grainTemplateValid)
+            {
+                m_grainTemplateParams       = m_picParams->m_filmGrainParams;
+                m_grainTemplateBitDepth     = m_bitDepthIndicator;
+                m_grainTemplateWidthMinus1  = m_picParams->m_superResUpscaledWidthMinus1;
+                m_grainTemplateHeightMinus1 = m_picParams->m_superResUpscaledHeightMinus1;
+            }
+        }
     }
 
 #if (_DEBUG || _RELEASE_INTERNAL)
@@ -971,6 +989,37 @@ MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
     return MOS_STATUS_SUCCESS;
 }
 
+bool Av1DecodeFilmGrainG12::IsGrainTemplateReusable(
+    CodecAv1PicParams *picParams)
+{
+    if (!m_grainTemplateValid || picParams == nullptr)
+    {
+        return false;
+    }
+
+    const CodecAv1FilmGrainParams &cur  = picParams->m_filmGrainParams;
+    const CodecAv1FilmGrainParams &prev = m_grainTemplateParams;
+
+    // Multipliers and offsets are consumed by apply noise curbe only, not part of templates.
+    return m_grainTemplateBitDepth == m_bitDepthIndicator &&
+        m_grainTemplateWidthMinus1 == picParams->m_superResUpscaledWidthMinus1 &&
+        m_grainTemplateHeightMinus1 == picParams->m_superResUpscaledHeightMinus1 &&
+        cur.m_filmGrainInfoFlags.m_value == prev.m_filmGrainInfoFlags.m_value &&
+        cur.m_randomSeed == prev.m_randomSeed &&
+        cur.m_numYPoints == prev.m_numYPoints &&
+        cur.m_numCbPoints == prev.m_numCbPoints &&
+        cur.m_numCrPoints == prev.m_numCrPoints &&
+        !memcmp(cur.m_pointYValue, prev.m_pointYValue, sizeof(cur.m_pointYValue)) &&
+        !memcmp(cur.m_pointYScaling, prev.m_pointYScaling, sizeof(cur.m_pointYScaling)) &&
+        !memcmp(cur.m_pointCbValue, prev.m_pointCbValue, sizeof(cur.m_pointCbValue)) &&
+        !memcmp(cur.m_pointCbScaling, prev.m_pointCbScaling, sizeof(cur.m_pointCbScaling)) &&
+        !memcmp(cur.m_pointCrValue, prev.m_pointCrValue, sizeof(cur.m_pointCrValue)) &&
+        !memcmp(cur.m_pointCrScaling, prev.m_pointCrScaling, sizeof(cur.m_pointCrScaling)) &&
+        !memcmp(cur.m_arCoeffsY, prev.m_arCoeffsY, sizeof(cur.m_arCoeffsY)) &&
+        !memcmp(cur.m_arCoeffsCb, prev.m_arCoeffsCb, sizeof(cur.m_arCoeffsCb)) &&
+        !memcmp(cur.m_arCoeffsCr, prev.m_arCoeffsCr, sizeof(cur.m_arCoeffsCr));
+}
+
 MOS_STATUS Av1DecodeFilmGrainG12::InitInterfaceStateHeapSetting()
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
@@ -218,10 +218,23 @@ public:
     MOS_STATUS SetFrameStates(
         CodecAv1PicParams *picParams);
 
+    //!
+    //! \brief    Check if grain templates of previous frame can be reused
+    //! \details  Grain templates and coordinates random values only depend on the
+    //!           generation related film grain params, bit depth and frame size
+    //! \param    [in] picParams
+    //!           Pointer to AV1 Decode picture params
+    //! \return   bool
+    //!           true if templates generated for previous frame match current frame
+    //!
+    bool IsGrainTemplateReusable(
+        CodecAv1PicParams *picParams);
+
     // Parameters passed from application
     CodecAv1SegmentsParams *m_segmentParams         = nullptr;          //!< Pointer to AV1 segments parameter
     CodecAv1TileParams *    m_av1TileParams         = nullptr;          //!< Pointer to AV1 tiles parameter
     bool                    m_filmGrainEnabled      = false;            //!< Per-frame film grain enable flag    
+    bool                    m_grainTemplateReused   = false;            //!< Per-frame flag, grain templates of previous frame are reused
 
     static const int32_t    m_filmGrainBindingTableCount[kernelNum];    //!< Binding table count for each kernel
     static const int32_t    m_filmGrainCurbeSize[kernelNum];            //!< Curbe size for each kernel
@@ -350,6 +363,12 @@ protected:
     Av1BasicFeatureG12 * m_basicFeature      = nullptr;
     bool                 m_resourceAllocated = false;
 
+    bool                    m_grainTemplateValid           = false;     //!< Grain templates in current dithering surfaces are valid
+    CodecAv1FilmGrainParams m_grainTemplateParams          = {};        //!< Film grain params grain templates generated with
+    uint8_t                 m_grainTemplateBitDepth        = 0;         //!< Bit depth indicator grain templates generated with
+    uint16_t                m_grainTemplateWidthMinus1     = 0;         //!< Upscaled width coordinates random values generated with
+    uint16_t                m_grainTemplateHeightMinus1    = 0;         //!< Upscaled height coordinates random values generated with
+
     // Surfaces arrayfor GetRandomValues
     BufferArray *                     m_coordinatesRandomValuesSurfaceArray   = nullptr;                      //!< Random values for coordinates, 1D buffer, size = RoundUp(ImageWidth / 64) * RoundUp(ImageHeight / 64) * sizeof(int)
 
@@ -103,7 +103,8 @@ MOS_STATUS FilmGrainPreSubPipeline::Begin()
 
 MOS_STATUS FilmGrainPreSubPipeline::DoFilmGrainGenerateNoise(const CodechalDecodeParams &decodeParams)
 {
-    if (m_filmGrainFeature->m_filmGrainEnabled)
+    // Grain templates generated for previous frame are still valid, only apply noise is needed.
+    if (m_filmGrainFeature->m_filmGrainEnabled && !m_filmGrainFeature->m_grainTemplateReused)
     {
         //Step1: Get Random Values
         DECODE_CHK_STATUS(GetRandomValuesKernel(decodeParams));
@@ -26,6 +26,7 @@
 
 #include "encode_hevc_vdenc_pipeline_adapter_xe_lpm_plus_base.h"
 #include "encode_utils.h"
+#include "encode_status_report.h"
 
 EncodeHevcVdencPipelineAdapterXe_Lpm_Plus_Base::EncodeHevcVdencPipelineAdapterXe_Lpm_Plus_Base(
     CodechalHwInterfaceNext     *hwInterface,
@@ -72,6 +73,21 @@ MOS_STATUS EncodeHevcVdencPipelineAdapterXe_Lpm_Plus_Base::GetStatusReport(
     return m_encoder->GetStatusReport(status, numStatus);
 }
 
+MOS_STATUS EncodeHevcVdencPipelineAdapterXe_Lpm_Plus_Base::GetSliceProgress(
+    uint32_t            *sliceSizes,
+    uint32_t            maxSlices,
+    uint32_t            &numSlices,
+    uint32_t            &passIndex)
+{
+    ENCODE_FUNC_CALL();
+
+    ENCODE_CHK_NULL_RETURN(m_encoder);
+    auto statusReport = dynamic_cast<encode::EncoderStatusReport *>(m_encoder->GetStatusReportInstance());
+    ENCODE_CHK_NULL_RETURN(statusReport);
+
+    return statusReport->GetSliceProgress(sliceSizes, maxSlices, numSlices, passIndex);
+}
+
 void EncodeHevcVdencPipelineAdapterXe_Lpm_Plus_Base::Destroy()
 {
     ENCODE_FUNC_CALL();
@@ -47,6 +47,8 @@ public:
 
     virtual MOS_STATUS GetStatusReport(void *status, uint16_t numStatus) override;
 
+    virtual MOS_STATUS GetSliceProgress(uint32_t *sliceSizes, uint32_t maxSlices, uint32_t &numSlices, uint32_t &passIndex) override;
+
     virtual void Destroy() override;
 
 protected:
@@ -155,6 +155,19 @@ MOS_STATUS MediaCopyStateXe_Lpm_Plus_Base::MediaBltCopy(PMOS_RESOURCE src, PMOS_
     }
 }
 
+MOS_STATUS MediaCopyStateXe_Lpm_Plus_Base::MediaBltCopyBatch(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t count)
+{
+    // implementation
+    if (m_bltState != nullptr)
+    {
+        return m_bltState->CopyMainSurfaces(src, dst, count);
+    }
+    else
+    {
+        return MOS_STATUS_UNIMPLEMENTED;
+    }
+}
+
 MOS_STATUS MediaCopyStateXe_Lpm_Plus_Base::MediaVeboxCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
 {
     // implementation
@@ -90,6 +90,20 @@ protected:
     //!
     virtual MOS_STATUS MediaBltCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst);
 
+    //!
+    //! \brief    use blt engie to do a batch of surface copies.
+    //! \details  implementation media blt copy with one submission for the batch.
+    //! \param    src
+    //!           [in] Pointer to array of source surfaces
+    //! \param    dst
+    //!           [in] Pointer to array of destination surfaces
+    //! \param    count
+    //!           [in] number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS MediaBltCopyBatch(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t count);
+
     //!
     //! \brief    use Render engie to do surface copy.
     //! \details  implementation media Render copy.
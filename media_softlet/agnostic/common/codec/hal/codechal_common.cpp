@@ -193,6 +193,20 @@ MOS_STATUS Codechal::GetStatusReport(
     return MOS_STATUS_UNKNOWN;
 }
 
+MOS_STATUS Codechal::GetSliceProgress(
+    uint32_t            *sliceSizes,
+    uint32_t            maxSlices,
+    uint32_t            &numSlices,
+    uint32_t            &passIndex)
+{
+    CODECHAL_PUBLIC_FUNCTION_ENTER;
+    MOS_UNUSED(sliceSizes);
+    MOS_UNUSED(maxSlices);
+    numSlices = 0;
+    passIndex = 0;
+    return MOS_STATUS_UNIMPLEMENTED;
+}
+
 void Codechal::Destroy()
 {
     CODECHAL_PUBLIC_FUNCTION_ENTER;
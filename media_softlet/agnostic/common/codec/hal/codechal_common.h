@@ -297,6 +297,29 @@ public:
         void                *status,
         uint16_t            numStatus);
 
+    //!
+    //! \brief    Gets the sizes of the slices already encoded for the oldest
+    //!           picture which has not been reported yet.
+    //! \details  Lets low latency users send out completed slices of a picture
+    //!           still being encoded. Only supported by some encoders.
+    //! \param    [out] sliceSizes
+    //!           Array to store the size in bytes of each completed slice
+    //! \param    [in] maxSlices
+    //!           The size of the sliceSizes array
+    //! \param    [out] numSlices
+    //!           Number of completed slices
+    //! \param    [out] passIndex
+    //!           BRC pass of the completed slices, a new pass encodes the
+    //!           picture again and invalidates slices of earlier passes
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success else fail reason
+    //!
+    virtual MOS_STATUS GetSliceProgress(
+        uint32_t            *sliceSizes,
+        uint32_t            maxSlices,
+        uint32_t            &numSlices,
+        uint32_t            &passIndex);
+
     //!
     //! \brief  Destroy codechl state
     //!
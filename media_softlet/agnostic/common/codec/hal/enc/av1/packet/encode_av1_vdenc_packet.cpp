@@ -367,6 +367,8 @@ namespace encode{
         m_av1PicParams  = ((Av1BasicFeature *)m_basicFeature)->m_av1PicParams;
         m_nalUnitParams = ((Av1BasicFeature *)m_basicFeature)->m_nalUnitParams;
 
+        m_avpSurfStateCmdsValid = false;
+
         SetRowstoreCachingOffsets();
 
         return MOS_STATUS_SUCCESS;
@@ -1042,6 +1044,17 @@ namespace encode{
         ENCODE_CHK_NULL_RETURN(cmdBuffer);
         ENCODE_CHK_NULL_RETURN(m_basicFeature);
 
+        // Surface states are the same for every tile of the frame and carry no
+        // graphics address, so later tiles copy the commands built for the first one
+        // instead of running every feature's SETPAR again.
+        if (m_avpSurfStateCmdsValid)
+        {
+            return m_osInterface->pfnAddCommand(cmdBuffer, m_avpSurfStateCmds.data(), (uint32_t)m_avpSurfStateCmds.size());
+        }
+
+        uint8_t *cmdStart    = (uint8_t *)cmdBuffer->pCmdPtr;
+        int32_t  startOffset = cmdBuffer->iOffset;
+
         m_curAvpSurfStateId = srcInputPic;
         SETPAR_AND_ADDCMD(AVP_SURFACE_STATE, m_avpItf, cmdBuffer);
 
@@ -1063,6 +1076,12 @@ namespace encode{
             }
         }
 
+        if (cmdStart != nullptr)
+        {
+            m_avpSurfStateCmds.assign(cmdStart, cmdStart + (cmdBuffer->iOffset - startOffset));
+            m_avpSurfStateCmdsValid = true;
+        }
+
         return MOS_STATUS_SUCCESS;
     }
 
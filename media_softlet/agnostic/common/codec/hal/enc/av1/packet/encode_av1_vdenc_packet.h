@@ -273,6 +273,9 @@ protected:
 
     mutable uint8_t m_curAvpSurfStateId = 0;
 
+    mutable std::vector<uint8_t> m_avpSurfStateCmds;                 //!< AVP_SURFACE_STATE commands of the first tile, replayed for later tiles
+    mutable bool                 m_avpSurfStateCmdsValid = false;    //!< m_avpSurfStateCmds holds the commands of current frame
+
     AtomicScratchBufferAv1 m_atomicScratchBuf = {};  //!< Stores atomic operands and result
 
     bool m_vdencPakObjCmdStreamOutEnabled               = false;    //!< Pakobj stream out enable flag
@@ -140,6 +140,12 @@ static void PutVLCCode(BSBuffer *bsbuffer, uint32_t code)
     else
     {
         leadingZeroBits = bitcount - 1;
+        if (leadingZeroBits < 16)
+        {
+            // prefix and suffix in one write, code + 1 has exactly bitcount significant bits
+            PutBits(bsbuffer, code + 1, 2 * leadingZeroBits + 1);
+            return;
+        }
         bits            = code + 1 - (1 << leadingZeroBits);
         PutBits(bsbuffer, 1, leadingZeroBits + 1);
         PutBits(bsbuffer, bits, leadingZeroBits);
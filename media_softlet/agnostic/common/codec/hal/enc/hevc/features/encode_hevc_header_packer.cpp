@@ -205,7 +205,9 @@ void HevcHeaderPacker::PackSSHPartIdAddr(
         if (pps.dependent_slice_segments_enabled_flag)
             bs.PutBit(slice.dependent_slice_segment_flag);
 
-        bs.PutBits(CeilLog2(PicSizeInCtbsY), slice.segment_address);
+        m_sshAddrBitOffset = bs.GetOffset();
+        m_sshAddrBitLen    = CeilLog2(PicSizeInCtbsY);
+        bs.PutBits(m_sshAddrBitLen, slice.segment_address);
     }
 }
 
@@ -524,6 +526,54 @@ MOS_STATUS HevcHeaderPacker::LoadSliceHeaderParams(CodecEncodeHevcSliceHeaderPar
     return MOS_STATUS_SUCCESS;
 }
 
+bool HevcHeaderPacker::IsSameSliceHeader(const CODEC_HEVC_ENCODE_SLICE_PARAMS &hevcSliceParams)
+{
+    if (!m_sshTemplateValid || hevcSliceParams.slice_segment_address == 0)
+    {
+        return false;
+    }
+
+    CODEC_HEVC_ENCODE_SLICE_PARAMS key;
+    MOS_SecureMemcpy(&key, sizeof(key), &hevcSliceParams, sizeof(hevcSliceParams));
+    key.slice_segment_address = 0;
+    key.NumLCUsInSlice        = 0;
+
+    return !memcmp(&key, &m_sshTemplateKey, sizeof(key));
+}
+
+void HevcHeaderPacker::SaveSliceHeaderTemplate(const CODEC_HEVC_ENCODE_SLICE_PARAMS &hevcSliceParams, const mfxU8 *ssh, mfxU32 bitLen)
+{
+    // first slice in picture has no segment address, so it can't serve as template
+    if (hevcSliceParams.slice_segment_address == 0 ||
+        MOS_SecureMemcpy(m_sshTemplate.data(), m_sshTemplate.size(), ssh, CeilDiv(bitLen, 8u)) != MOS_STATUS_SUCCESS)
+    {
+        m_sshTemplateValid = false;
+        return;
+    }
+
+    MOS_SecureMemcpy(&m_sshTemplateKey, sizeof(m_sshTemplateKey), &hevcSliceParams, sizeof(hevcSliceParams));
+    m_sshTemplateKey.slice_segment_address = 0;
+    m_sshTemplateKey.NumLCUsInSlice        = 0;
+    m_sshTemplateBitLen                    = bitLen;
+    m_sshTemplateValid                     = true;
+}
+
+void HevcHeaderPacker::PatchBits(mfxU8 *buf, mfxU32 bitOffset, mfxU32 n, mfxU32 b)
+{
+    for (mfxU32 i = 0; i < n; i++, bitOffset++)
+    {
+        mfxU8 mask = (mfxU8)(0x80 >> (bitOffset & 7));
+        if ((b >> (n - 1 - i)) & 1)
+        {
+            buf[bitOffset >> 3] |= mask;
+        }
+        else
+        {
+            buf[bitOffset >> 3] &= ~mask;
+        }
+    }
+}
+
 MOS_STATUS HevcHeaderPacker::SliceHeaderPacker(EncoderParams *encodeParams)
 {
     MOS_OS_FUNCTION_ENTER;
@@ -549,13 +599,30 @@ MOS_STATUS HevcHeaderPacker::SliceHeaderPacker(EncoderParams *encodeParams)
     for (uint32_t startLcu = 0, slcCount = 0; slcCount < encodeParams->dwNumSlices; slcCount++)
     {
         //startLcu += m_hevcSliceParams[slcCount].NumLCUsInSlice;
-        ENCODE_CHK_STATUS_RETURN(GetSliceParams(static_cast<PCODEC_HEVC_ENCODE_SLICE_PARAMS>(encodeParams->pSliceParams)[slcCount]));
-        ENCODE_CHK_STATUS_RETURN(LoadSliceHeaderParams((CodecEncodeHevcSliceHeaderParams*) pCodecHalEncodeParams->pSliceHeaderParams));
-        
-        rbsp.Reset(pBegin, mfxU32(pEnd - pBegin));
-        m_naluParams.long_start_code = 0/*pBSBuffer->pCurrent + (BitLenRecorded + 7) / 8 == pBSBuffer->pBase*/;
-        PackSSH(rbsp, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams, m_bDssEnabled);
-        BitLen = rbsp.GetOffset();
+        const CODEC_HEVC_ENCODE_SLICE_PARAMS &hevcSliceParams = static_cast<PCODEC_HEVC_ENCODE_SLICE_PARAMS>(encodeParams->pSliceParams)[slcCount];
+
+        if (IsSameSliceHeader(hevcSliceParams))
+        {
+            // Only slice_segment_address differs from the previous slice, copy its header and patch the address
+            BitLen = m_sshTemplateBitLen;
+            ENCODE_CHK_STATUS_RETURN(MOS_SecureMemcpy(pBegin, pEnd - pBegin, m_sshTemplate.data(), CeilDiv(BitLen, 8u)));
+            if (m_sshAddrBitLen)
+            {
+                PatchBits(pBegin, m_sshAddrBitOffset, m_sshAddrBitLen, hevcSliceParams.slice_segment_address);
+            }
+        }
+        else
+        {
+            ENCODE_CHK_STATUS_RETURN(GetSliceParams(hevcSliceParams));
+            ENCODE_CHK_STATUS_RETURN(LoadSliceHeaderParams((CodecEncodeHevcSliceHeaderParams*) pCodecHalEncodeParams->pSliceHeaderParams));
+
+            rbsp.Reset(pBegin, mfxU32(pEnd - pBegin));
+            m_naluParams.long_start_code = 0/*pBSBuffer->pCurrent + (BitLenRecorded + 7) / 8 == pBSBuffer->pBase*/;
+            m_sshAddrBitLen              = 0;
+            PackSSH(rbsp, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams, m_bDssEnabled);
+            BitLen = rbsp.GetOffset();
+            SaveSliceHeaderTemplate(hevcSliceParams, pBegin, BitLen);
+        }
         pBegin += CeilDiv(BitLen, 8u);
         pSlcData[slcCount].SliceOffset            = (uint32_t)(pBSBuffer->pCurrent + (BitLenRecorded + 7) / 8 - pBSBuffer->pBase);
         pSlcData[slcCount].BitSize                = BitLen * 1 + (BitLen + 7) / 8 * !1;
@@ -491,6 +491,14 @@ public:
     std::array<mfxU8, 1024> m_rbsp          = {};
     bool                    m_bDssEnabled   = false;
 
+    // Slice header template, reused by following slices which differ only in segment address
+    bool                           m_sshTemplateValid     = false;
+    CODEC_HEVC_ENCODE_SLICE_PARAMS m_sshTemplateKey       = {};
+    std::array<mfxU8, 128>         m_sshTemplate          = {};
+    mfxU32                         m_sshTemplateBitLen    = 0;
+    mfxU32                         m_sshAddrBitOffset     = 0;
+    mfxU32                         m_sshAddrBitLen        = 0;
+
 public:
     HevcHeaderPacker();
     MOS_STATUS SliceHeaderPacker(EncoderParams *encodeParams);
@@ -507,6 +515,9 @@ public:
               HevcSlice const &slice,
               bool             dyn_slice_size);
     void PackNALU(BitstreamWriter &bs, NALU const &h);
+    bool IsSameSliceHeader(const CODEC_HEVC_ENCODE_SLICE_PARAMS &hevcSliceParams);
+    void SaveSliceHeaderTemplate(const CODEC_HEVC_ENCODE_SLICE_PARAMS &hevcSliceParams, const mfxU8 *ssh, mfxU32 bitLen);
+    static void PatchBits(mfxU8 *buf, mfxU32 bitOffset, mfxU32 n, mfxU32 b);
     void PackSSHPartIdAddr(
         BitstreamWriter &bs,
         NALU const &     nalu,
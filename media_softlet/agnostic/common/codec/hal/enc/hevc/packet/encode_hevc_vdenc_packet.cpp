@@ -457,6 +457,13 @@ namespace encode
             }
             m_basicFeature->m_curNumSlices = slcCount;
 
+            if (m_sliceProgressEnabled && slcCount == 0 && !m_pipeline->IsFirstPass())
+            {
+                // The frame is encoded again, restart the progress under the new pass index
+                ENCODE_CHK_STATUS_RETURN(StoreSliceProgress(CODECHAL_OFFSETOF(EncodeStatusSliceProgress, numCompletedSlices), 0, cmdBuffer));
+                ENCODE_CHK_STATUS_RETURN(StoreSliceProgress(CODECHAL_OFFSETOF(EncodeStatusSliceProgress, passIndex), m_pipeline->GetCurrentPass(), cmdBuffer));
+            }
+
             ENCODE_CHK_STATUS_RETURN(SendHwSliceEncodeCommand(nullptr, slcCount, cmdBuffer));
 
             startLcu += m_hevcSliceParams[slcCount].NumLCUsInSlice;
@@ -473,6 +480,8 @@ namespace encode
 
             m_flushCmd = waitVdenc;
             SETPAR_AND_ADDCMD(VD_PIPELINE_FLUSH, m_vdencItf, &cmdBuffer);
+
+            ENCODE_CHK_STATUS_RETURN(ReportSliceProgress(slcCount, cmdBuffer));
         }
 
         if (m_useBatchBufferForPakSlices)
@@ -1592,6 +1601,24 @@ MOS_STATUS HevcVdencPkt::AddAllCmds_HCP_PAK_INSERT_OBJECT_BRC(PMOS_COMMAND_BUFFE
 
         ENCODE_CHK_STATUS_RETURN(m_statusReport->RegistObserver(this));
 
+        // Slice progress is for low latency streaming, other users don't pay for the per slice stores
+        if (m_userSettingPtr == nullptr)
+        {
+            m_userSettingPtr = m_osInterface->pfnGetUserSettingInstance(m_osInterface);
+        }
+        MediaUserSetting::Value outValue;
+        ReadUserSetting(
+            m_userSettingPtr,
+            outValue,
+            "HEVC VDEnc Slice Progress Enable",
+            MediaUserSetting::Group::Sequence);
+        m_sliceProgressEnabled = outValue.Get<bool>();
+        auto statusReport = dynamic_cast<EncoderStatusReport *>(m_statusReport);
+        if (statusReport != nullptr)
+        {
+            statusReport->SetSliceProgressEnabled(m_sliceProgressEnabled);
+        }
+
         CalculatePictureStateCommandSize();
 
         uint32_t vdencPictureStatesSize = 0, vdencPicturePatchListSize = 0;
@@ -2013,6 +2040,52 @@ MOS_STATUS HevcVdencPkt::AddAllCmds_HCP_PAK_INSERT_OBJECT_BRC(PMOS_COMMAND_BUFFE
         return eStatus;
     }
 
+    MOS_STATUS HevcVdencPkt::ReportSliceProgress(uint32_t slcCount, MOS_COMMAND_BUFFER &cmdBuffer)
+    {
+        ENCODE_FUNC_CALL();
+
+        // Every pass records its progress, BRC may end the frame before the last pass
+        if (!m_sliceProgressEnabled || slcCount >= ENCODE_STATUS_MAX_PROGRESS_SLICES)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        MOS_RESOURCE *osResource = nullptr;
+        uint32_t      offset     = 0;
+        ENCODE_CHK_STATUS_RETURN(m_statusReport->GetAddress(statusReportSliceProgress, osResource, offset));
+
+        // The frame byte count register accumulates over the slices of the frame
+        auto  mmioRegisters                 = m_hcpItf->GetMmioRegisters(m_vdboxIndex);
+        auto &miStoreRegMemParams           = m_miItf->MHW_GETPAR_F(MI_STORE_REGISTER_MEM)();
+        miStoreRegMemParams                 = {};
+        miStoreRegMemParams.presStoreBuffer = osResource;
+        miStoreRegMemParams.dwOffset        = offset + CODECHAL_OFFSETOF(EncodeStatusSliceProgress, cumulativeByteCount[0]) + slcCount * sizeof(uint32_t);
+        miStoreRegMemParams.dwRegister      = mmioRegisters->hcpEncBitstreamBytecountFrameRegOffset;
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_STORE_REGISTER_MEM)(&cmdBuffer));
+
+        ENCODE_CHK_STATUS_RETURN(StoreSliceProgress(CODECHAL_OFFSETOF(EncodeStatusSliceProgress, numCompletedSlices), slcCount + 1, cmdBuffer));
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS HevcVdencPkt::StoreSliceProgress(uint32_t fieldOffset, uint32_t value, MOS_COMMAND_BUFFER &cmdBuffer)
+    {
+        ENCODE_FUNC_CALL();
+
+        MOS_RESOURCE *osResource = nullptr;
+        uint32_t      offset     = 0;
+        ENCODE_CHK_STATUS_RETURN(m_statusReport->GetAddress(statusReportSliceProgress, osResource, offset));
+
+        auto &storeDataParams            = m_miItf->MHW_GETPAR_F(MI_STORE_DATA_IMM)();
+        storeDataParams                  = {};
+        storeDataParams.pOsResource      = osResource;
+        storeDataParams.dwResourceOffset = offset + fieldOffset;
+        storeDataParams.dwValue          = value;
+        ENCODE_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_STORE_DATA_IMM)(&cmdBuffer));
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MOS_STATUS HevcVdencPkt::ReadSliceSizeForSinglePipe(MOS_COMMAND_BUFFER &cmdBuffer)
     {
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
@@ -2258,6 +2331,17 @@ MOS_STATUS HevcVdencPkt::AddAllCmds_HCP_PAK_INSERT_OBJECT_BRC(PMOS_COMMAND_BUFFE
             mhw::vdbox::hcp::Itf::MI_BATCH_BUFFER_START_CMD_NUMBER_OF_ADDRESSES * 2 +  // One is for the PAK command and another one is for the BB when BRC and single task mode are on
             mhw::vdbox::hcp::Itf::HCP_TILE_CODING_COMMAND_NUMBER_OF_ADDRESSES;         // HCP_TILE_CODING_STATE command
 
+        if (m_sliceProgressEnabled)
+        {
+            // Byte count and slice count per slice, pass index and slice count on pass restart
+            hcpCommandsSize +=
+                m_miItf->MHW_GETSIZE_F(MI_STORE_REGISTER_MEM)() +
+                m_miItf->MHW_GETSIZE_F(MI_STORE_DATA_IMM)() * 3;
+            hcpPatchListSize +=
+                mhw::vdbox::hcp::Itf::MI_STORE_REGISTER_MEM_CMD_NUMBER_OF_ADDRESSES +
+                mhw::vdbox::hcp::Itf::MI_STORE_DATA_IMM_CMD_NUMBER_OF_ADDRESSES * 3;
+        }
+
         uint32_t cpCmdsize = 0;
         uint32_t cpPatchListSize = 0;
         if (m_hwInterface->GetCpInterface())
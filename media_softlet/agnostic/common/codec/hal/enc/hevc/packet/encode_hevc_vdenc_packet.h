@@ -443,6 +443,35 @@ namespace encode
 
         void SetPakPassType();
 
+        //!
+        //! \brief    Add commands to record the bitstream byte count after a slice
+        //!           so the coded part of the frame can be queried before it completes
+        //!
+        //! \param    [in] slcCount
+        //!           Index of the slice just finished
+        //! \param    [in, out] cmdBuffer
+        //!           Command buffer
+        //!
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS ReportSliceProgress(uint32_t slcCount, MOS_COMMAND_BUFFER &cmdBuffer);
+
+        //!
+        //! \brief    Add command to store a field of the slice progress of the frame
+        //!
+        //! \param    [in] fieldOffset
+        //!           Offset of the field in EncodeStatusSliceProgress
+        //! \param    [in] value
+        //!           Value to store
+        //! \param    [in, out] cmdBuffer
+        //!           Command buffer
+        //!
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS StoreSliceProgress(uint32_t fieldOffset, uint32_t value, MOS_COMMAND_BUFFER &cmdBuffer);
+
         MOS_STATUS ReadSliceSizeForSinglePipe(MOS_COMMAND_BUFFER &cmdBuffer);
 
         MOS_STATUS ReadSliceSize(MOS_COMMAND_BUFFER &cmdBuffer);
@@ -616,6 +645,8 @@ namespace encode
 
         bool m_useBatchBufferForPakSlices = false;
 
+        bool m_sliceProgressEnabled = false;  //!< Record per slice progress for low latency streaming
+
         int32_t  m_batchBufferForPakSlicesStartOffset    = 0;
         uint32_t m_sizeOfSseSrcPixelRowStoreBufferPerLcu = 0;  //!< Size of SSE row store buffer per LCU
 
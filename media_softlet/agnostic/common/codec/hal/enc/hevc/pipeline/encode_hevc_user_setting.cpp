@@ -37,6 +37,12 @@ MOS_STATUS HevcPipeline::InitUserSetting(MediaUserSettingSharedPtr userSettingPt
         MediaUserSetting::Group::Sequence,
         int32_t(0),
         true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "HEVC VDEnc Slice Progress Enable",
+        MediaUserSetting::Group::Sequence,
+        int32_t(0),
+        false);
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKey(
         userSettingPtr,
@@ -138,8 +138,16 @@ void BitstreamWriter::PutGolomb(mfxU32 b)
         while (b >> n)
             n++;
 
-        PutBits(n - 1, 0);
-        PutBits(n, b);
+        if (n <= 16)
+        {
+            // leading zeros and info bits fit one word, b has exactly n significant bits
+            PutBits(2 * n - 1, b);
+        }
+        else
+        {
+            PutBits(n - 1, 0);
+            PutBits(n, b);
+        }
     }
 }
 
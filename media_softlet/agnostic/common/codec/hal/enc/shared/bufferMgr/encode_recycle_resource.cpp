@@ -57,13 +57,15 @@ RecycleResource::RecycleResource(EncodeAllocator *allocator)
 
 RecycleResource::~RecycleResource()
 {
-    for (auto pair : m_resourceQueues)
+    for (auto &que : m_resourceQueues)
     {
-        auto que = pair.second;
+        if (que == nullptr)
+        {
+            continue;
+        }
         que->DestroyAllResources(m_allocator);
         MOS_Delete(que);
     }
-    m_resourceQueues.clear();
 }
 
 MOS_STATUS RecycleResource::RegisterResource(
@@ -71,9 +73,7 @@ MOS_STATUS RecycleResource::RegisterResource(
     MOS_ALLOC_GFXRES_PARAMS param, 
     uint32_t maxLimit)
 {
-    auto it = m_resourceQueues.find(id);
-    
-    if (it != m_resourceQueues.end())
+    if (static_cast<uint32_t>(id) >= RecycleResIdNum || m_resourceQueues[id] != nullptr)
     {
         return MOS_STATUS_INVALID_PARAMETER;
     }
@@ -84,7 +84,7 @@ MOS_STATUS RecycleResource::RegisterResource(
         return MOS_STATUS_CLIENT_AR_NO_SPACE;
     }
 
-    m_resourceQueues.insert(std::make_pair(id, que));
+    m_resourceQueues[id] = que;
 
     return MOS_STATUS_SUCCESS;
 }
@@ -33,6 +33,7 @@
 #include "mos_os.h"
 #include "mos_os_specific.h"
 #include <stdint.h>
+#include <array>
 #include <map>
 #include <utility>
 
@@ -65,6 +66,7 @@ namespace encode
 #include "encode_recycle_resource_ext.h"
 #undef RECYCLE_IDS_EXT
 #endif
+        RecycleResIdNum
     };
 
 class EncodeAllocator;
@@ -130,20 +132,18 @@ protected:
     //!
     RecycleQueue *GetResQueue(RecycleResId id)
     {
-        auto it = m_resourceQueues.find(id);
-
-        if (it == m_resourceQueues.end())
+        if (static_cast<uint32_t>(id) >= RecycleResIdNum)
         {
             return nullptr;
         }
 
-        return it->second;
+        return m_resourceQueues[id];
     }
 
     static const uint8_t m_maxRecycleNum = 6;
     EncodeAllocator *m_allocator     = nullptr;  //!< encoder allocator
 
-    std::map<RecycleResId, RecycleQueue *> m_resourceQueues{};  //!< resource queues
+    std::array<RecycleQueue *, RecycleResIdNum> m_resourceQueues{};  //!< resource queues indexed by RecycleResId
 
 MEDIA_CLASS_DEFINE_END(encode__RecycleResource)
 };
@@ -34,12 +34,20 @@
 
 namespace encode {
 constexpr MapBufferResourceType TrackedBuffer::m_mapBufferResourceType[];
+constexpr uint32_t              TrackedBuffer::m_bufferTypeNum;
 TrackedBuffer::TrackedBuffer(EncodeAllocator *allocator, uint8_t maxRefCnt, uint8_t maxNonRefCnt)
     : m_maxRefSlotCnt(maxRefCnt),
       m_maxNonRefSlotCnt(maxNonRefCnt),
       m_allocator(allocator)
 {
     m_maxSlotCnt = m_maxRefSlotCnt + m_maxNonRefSlotCnt;
+
+    m_resourceTypes.fill(ResourceType::invalidResource);
+    for (auto pair : m_mapBufferResourceType)
+    {
+        m_resourceTypes[static_cast<uint32_t>(pair.buffer)] = pair.type;
+    }
+
     for (uint8_t i = 0; i < m_maxSlotCnt; i++)
     {
         m_bufferSlots.push_back(MOS_New(BufferSlot, this));
@@ -55,7 +63,10 @@ TrackedBuffer::~TrackedBuffer()
         (*it)->Reset();
         MOS_Delete(*it);
     }
-    m_bufferQueue.clear();
+    for (auto &queue : m_bufferQueue)
+    {
+        queue.reset();
+    }
     m_oldQueue.clear();
 
     MosUtilities::MosDestroyMutex(m_mutex);
@@ -63,17 +74,15 @@ TrackedBuffer::~TrackedBuffer()
 
 MOS_STATUS TrackedBuffer::RegisterParam(BufferType type, MOS_ALLOC_GFXRES_PARAMS param)
 {
-    auto iter = m_allocParams.find(type);
-    if (iter == m_allocParams.end())
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeNum)
     {
-        m_allocParams.insert(std::make_pair(type, param));
-    }
-    else
-    {
-        // erase the older param and insert new one when resultion change happens
-        m_allocParams.erase(iter);
-        m_allocParams.insert(std::make_pair(type, param));
+        return MOS_STATUS_INVALID_PARAMETER;
     }
+
+    // overwrite the older param when resultion change happens
+    m_allocParams[index]      = param;
+    m_allocParamsValid[index] = true;
     return MOS_STATUS_SUCCESS;
 }
 
@@ -203,7 +212,7 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
     {
         for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
         {
-            if (iter->second->SafeToDestory())
+            if ((*iter)->SafeToDestory())
             {
                 iter = m_oldQueue.erase(iter);
             }
@@ -219,23 +228,14 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
 
 MOS_STATUS TrackedBuffer::OnSizeChange()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    // queues still holding resources of in-flight slots are parked until they drain
+    for (auto &queue : m_bufferQueue)
     {
-        if (iter->second->SafeToDestory())
-        {
-            iter = m_bufferQueue.erase(iter);
-        }
-        else
+        if (queue != nullptr && !queue->SafeToDestory())
         {
-            iter++;
+            m_oldQueue.push_back(std::move(queue));
         }
-    }
-
-    if (!m_bufferQueue.empty())
-    {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
+        queue.reset();
     }
 
     return MOS_STATUS_SUCCESS;
@@ -245,7 +245,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
 
-    if (index > m_maxSlotCnt || resType != ResourceType::surfaceResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::surfaceResource)
     {
         return nullptr;
     }
@@ -256,7 +256,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
-    if (index > m_maxSlotCnt || resType != ResourceType::bufferResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::bufferResource)
     {
         return nullptr;
     }
@@ -264,28 +264,27 @@ MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
     return (MOS_RESOURCE *)m_bufferSlots[index]->GetResource(type);
 }
 
-std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
+BufferQueue *TrackedBuffer::GetBufferQueue(BufferType type)
 {
-    auto iter = m_bufferQueue.find(type);
-    if (iter == m_bufferQueue.end())
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeNum)
     {
-        auto param = m_allocParams.find(type);
-        if (param == m_allocParams.end())
+        return nullptr;
+    }
+
+    if (m_bufferQueue[index] == nullptr)
+    {
+        if (!m_allocParamsValid[index])
         {
             return nullptr;
         }
 
-        ResourceType resType = GetResourceType(type);
-
-        auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
-        alloc->SetResourceType(resType);
-        m_bufferQueue.insert(std::make_pair(type, alloc));
-        return alloc;
-    }
-    else
-    {
-        return iter->second;
+        auto alloc = std::make_shared<BufferQueue>(m_allocator, m_allocParams[index], m_maxSlotCnt);
+        alloc->SetResourceType(m_resourceTypes[index]);
+        m_bufferQueue[index] = alloc;
     }
+
+    return m_bufferQueue[index].get();
 }
 
 }
\ No newline at end of file
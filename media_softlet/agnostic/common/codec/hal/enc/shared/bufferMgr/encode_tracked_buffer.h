@@ -37,6 +37,7 @@
 #include "mos_os.h"
 #include "mos_os_specific.h"
 #include <stdint.h>
+#include <array>
 #include <map>
 #include <memory>
 #include <vector>
@@ -70,6 +71,7 @@ enum class BufferType
     preencRef0,
     preencRef1,
     AlignedRawSurface,
+    maxBufferType,  //!< number of buffer types, must be the last one
 };
 
 struct MapBufferResourceType
@@ -181,17 +183,10 @@ protected:
     //! \return ResourceType
     //!         return the ResourceType
     //!
-    ResourceType GetResourceType(BufferType buffer)
+    ResourceType GetResourceType(BufferType buffer) const
     {
-        for (auto pair : m_mapBufferResourceType)
-        {
-            if (pair.buffer == buffer)
-            {
-                return pair.type;
-            }
-        }
-
-        return ResourceType::invalidResource;
+        uint32_t index = static_cast<uint32_t>(buffer);
+        return index < m_bufferTypeNum ? m_resourceTypes[index] : ResourceType::invalidResource;
     }
 
     //!
@@ -209,7 +204,9 @@ protected:
     //!         BufferType
     //! \return shared_ptr<BufferQueue>
     //!         shared_ptr<BufferQueue> if success, else nullptr
-    std::shared_ptr<BufferQueue> GetBufferQueue(BufferType type);
+    BufferQueue *GetBufferQueue(BufferType type);
+
+    static constexpr uint32_t m_bufferTypeNum = static_cast<uint32_t>(BufferType::maxBufferType);
 
     static constexpr MapBufferResourceType m_mapBufferResourceType[] =
     {
@@ -245,9 +242,11 @@ protected:
     EncodeAllocator *         m_allocator = nullptr;  //!< encoder allocator
     std::vector<BufferSlot *> m_bufferSlots = {};          //!< buffer slots
 
-    std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+    std::array<ResourceType, m_bufferTypeNum>                 m_resourceTypes    = {};  //!< resource type indexed by buffer type
+    std::array<bool, m_bufferTypeNum>                         m_allocParamsValid = {};  //!< whether allocate parameters are registered
+    std::array<MOS_ALLOC_GFXRES_PARAMS, m_bufferTypeNum>      m_allocParams      = {};  //!< allocate parameters indexed by buffer type
+    std::array<std::shared_ptr<BufferQueue>, m_bufferTypeNum> m_bufferQueue      = {};  //!< buffer queues indexed by buffer type
+    std::vector<std::shared_ptr<BufferQueue>>                 m_oldQueue         = {};  //!< old queues for resolution change
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
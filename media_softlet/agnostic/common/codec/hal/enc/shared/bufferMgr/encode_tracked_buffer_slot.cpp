@@ -25,7 +25,6 @@
 //! \details  The slot manages the buffers with the same type
 //!
 #include "encode_tracked_buffer_slot.h"
-#include <utility>
 #include "encode_tracked_buffer_queue.h"
 
 namespace encode {
@@ -37,25 +36,29 @@ BufferSlot::BufferSlot(TrackedBuffer* tracker) :
 
 BufferSlot::~BufferSlot()
 {
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
+    for (uint32_t i = 0; i < TrackedBuffer::m_bufferTypeNum; i++)
     {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
+        if (m_buffers[i] != nullptr && m_bufferQueues[i] != nullptr)
+        {
+            m_bufferQueues[i]->ReleaseResource(m_buffers[i]);
+        }
     }
-    m_buffers.clear();
-    m_bufferQueues.clear();
+    m_buffers.fill(nullptr);
+    m_bufferQueues.fill(nullptr);
 }
 
 MOS_STATUS BufferSlot::Reset()
 {
     m_isBusy = false;
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
+    for (uint32_t i = 0; i < TrackedBuffer::m_bufferTypeNum; i++)
     {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
+        if (m_buffers[i] != nullptr && m_bufferQueues[i] != nullptr)
+        {
+            m_bufferQueues[i]->ReleaseResource(m_buffers[i]);
+        }
     }
-    m_buffers.clear();
-    m_bufferQueues.clear();
+    m_buffers.fill(nullptr);
+    m_bufferQueues.fill(nullptr);
 
     return MOS_STATUS_SUCCESS;
 }
@@ -68,14 +71,19 @@ void *BufferSlot::GetResource(BufferType type)
         return nullptr;
     }
 
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= TrackedBuffer::m_bufferTypeNum)
+    {
+        return nullptr;
+    }
+
     // if surface already in the pool, return it directly
-    auto iter = m_buffers.find(type);
-    if (iter != m_buffers.end())
+    if (m_buffers[index] != nullptr)
     {
-        return iter->second;
+        return m_buffers[index];
     }
 
-    std::shared_ptr<BufferQueue> queue = m_tracker->GetBufferQueue(type);
+    BufferQueue *queue = m_tracker->GetBufferQueue(type);
     if (queue == nullptr)
     {
         return nullptr;
@@ -83,8 +91,11 @@ void *BufferSlot::GetResource(BufferType type)
 
     void* resource = queue->AcquireResource();
     // record the surface acquired, only one surface for each type should be kept in the slot
-    m_buffers.insert(std::make_pair(type, resource));
-    m_bufferQueues.insert(std::make_pair(type, queue));
+    if (resource != nullptr)
+    {
+        m_buffers[index]      = resource;
+        m_bufferQueues[index] = queue;
+    }
     return resource;
 }
 
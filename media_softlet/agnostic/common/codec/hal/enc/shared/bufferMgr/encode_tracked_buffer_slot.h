@@ -31,8 +31,7 @@
 #include "media_class_trace.h"
 #include "mos_defs.h"
 #include <stdint.h>
-#include <map>
-#include <memory>
+#include <array>
 
 namespace encode {
 
@@ -107,8 +106,8 @@ protected:
     TrackedBuffer *m_tracker  = nullptr;   //!< pointer to TrackedBuffer
     bool           m_isBusy   = false;     //!< whether the slot is been using
 
-    std::map<BufferType, void *>                        m_buffers      = {};  //!< buffers attached with current slot
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueues = {};  //!< buffer queue for all types
+    std::array<void *, TrackedBuffer::m_bufferTypeNum>        m_buffers      = {};  //!< buffers attached with current slot, indexed by buffer type
+    std::array<BufferQueue *, TrackedBuffer::m_bufferTypeNum> m_bufferQueues = {};  //!< queues the buffers are acquired from, owned by the tracker
 
 MEDIA_CLASS_DEFINE_END(encode__BufferSlot)
 };
@@ -25,6 +25,7 @@
 //! \details  
 //!
 #include <cmath>
+#include <atomic>
 #include "encode_status_report.h"
 
 namespace encode {
@@ -175,6 +176,7 @@ namespace encode {
         m_statusBufAddr[statusReportNumSkip8x8Block].offset                       = CODECHAL_OFFSETOF(EncodeStatusMfx, numSkip8x8Block);
         m_statusBufAddr[statusReportSliceReport].offset                           = CODECHAL_OFFSETOF(EncodeStatusMfx, sliceReport);
         m_statusBufAddr[statusReportLpla].offset                                  = CODECHAL_OFFSETOF(EncodeStatusMfx, lookaheadStatus);
+        m_statusBufAddr[statusReportSliceProgress].offset                         = CODECHAL_OFFSETOF(EncodeStatusMfx, sliceProgress);
     }
 
     MOS_STATUS EncoderStatusReport::Init(void *inputPar)
@@ -235,8 +237,11 @@ namespace encode {
     MOS_STATUS EncoderStatusReport::Reset()
     {
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-        
+
+        // GetSliceProgress may be called from another thread
+        Lock();
         m_submittedCount++;
+        UnLock();
 
         uint32_t submitIndex = CounterToIndex(m_submittedCount);
 
@@ -255,6 +260,65 @@ namespace encode {
         return eStatus;
     }
 
+    MOS_STATUS EncoderStatusReport::GetSliceProgress(uint32_t *sliceSizes, uint32_t maxSlices, uint32_t &numSlices, uint32_t &passIndex)
+    {
+        ENCODE_FUNC_CALL();
+
+        numSlices = 0;
+        passIndex = 0;
+
+        if (!m_sliceProgressEnabled)
+        {
+            return MOS_STATUS_UNIMPLEMENTED;
+        }
+
+        ENCODE_CHK_NULL_RETURN(sliceSizes);
+        ENCODE_CHK_NULL_RETURN(m_dataStatusMfx);
+
+        // GetReport moves m_reportedCount under the lock, and temporarily sets it to an index
+        Lock();
+        uint32_t reportedCount  = m_reportedCount;
+        uint32_t submittedCount = m_submittedCount;
+        UnLock();
+
+        if (reportedCount == submittedCount)
+        {
+            // Nothing in flight
+            return MOS_STATUS_SUCCESS;
+        }
+
+        uint32_t         reportIndex     = CounterToIndex(reportedCount);
+        EncodeStatusMfx *encodeStatusMfx = (EncodeStatusMfx *)(m_dataStatusMfx + reportIndex * m_statusBufSizeMfx);
+
+        volatile EncodeStatusSliceProgress *sliceProgress = &encodeStatusMfx->sliceProgress;
+
+        // numCompletedSlices is written after the byte count of that slice, so read it
+        // first and keep the byte counts from being loaded ahead of it
+        uint32_t pass = sliceProgress->passIndex;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t count = MOS_MIN(sliceProgress->numCompletedSlices, MOS_MIN(maxSlices, (uint32_t)ENCODE_STATUS_MAX_PROGRESS_SLICES));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        uint32_t prevCumulativeSize = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t cumulativeSize = sliceProgress->cumulativeByteCount[i];
+            sliceSizes[i]           = cumulativeSize - prevCumulativeSize;
+            prevCumulativeSize      = cumulativeSize;
+        }
+
+        // A new pass started meanwhile, the byte counts may mix both passes
+        std::atomic_thread_fence(std::memory_order_acquire);
+        passIndex = sliceProgress->passIndex;
+        if (passIndex != pass)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+        numSlices = count;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     PMOS_RESOURCE EncoderStatusReport::GetHwCtrBuf()
     {
         return m_hwcounterBuf;
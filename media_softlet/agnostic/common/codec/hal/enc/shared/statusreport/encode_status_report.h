@@ -333,6 +333,32 @@ namespace encode {
 
         virtual PMOS_RESOURCE GetHwCtrBuf();
 
+        //!
+        //! \brief  Get the sizes of the slices PAK has completed so far for the
+        //!         oldest frame which is not reported yet.
+        //! \details Slices reported for an earlier pass index are overwritten
+        //!         by the re-encode of the next BRC pass.
+        //! \param  [out] sliceSizes
+        //!         Array to receive the size in bytes of each completed slice
+        //! \param  [in] maxSlices
+        //!         Number of entries in sliceSizes
+        //! \param  [out] numSlices
+        //!         Number of completed slices returned
+        //! \param  [out] passIndex
+        //!         BRC pass the completed slices belong to
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success,
+        //!         MOS_STATUS_UNIMPLEMENTED if slice progress is not enabled, else fail reason
+        //!
+        MOS_STATUS GetSliceProgress(uint32_t *sliceSizes, uint32_t maxSlices, uint32_t &numSlices, uint32_t &passIndex);
+
+        //!
+        //! \brief  Set whether the encoder records slice progress of its frames.
+        //! \param  [in] enable
+        //!         True if slice progress is recorded
+        //!
+        void SetSliceProgressEnabled(bool enable) { m_sliceProgressEnabled = enable; }
+
     protected:
         //!
         //! \brief  Collect the status report information into report buffer.
@@ -407,6 +433,7 @@ namespace encode {
         bool                   m_enableMfx = false;
         bool                   m_enableRcs = false;
         bool                   m_enableCp  = false;
+        bool                   m_sliceProgressEnabled = false;
 
         const uint32_t         m_statusBufSizeMfx = MOS_ALIGN_CEIL(sizeof(EncodeStatusMfx), sizeof(uint64_t));
         const uint32_t         m_statusBufSizeRcs = MOS_ALIGN_CEIL(sizeof(EncodeStatusRcs), sizeof(uint64_t));
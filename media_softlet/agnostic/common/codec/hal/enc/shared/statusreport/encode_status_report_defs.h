@@ -127,6 +127,7 @@ enum EncodeStatusReportType
     statusReportSliceReport,
     statusReportLpla,
     statusReportHucStatus2Reg,
+    statusReportSliceProgress,
     statusReportMfxMaxNum,
 
     statusReportMaxNum
@@ -287,6 +288,23 @@ struct EncodeStatusSliceReport
     uint32_t                        reserved;
 };
 
+#define ENCODE_STATUS_MAX_PROGRESS_SLICES 64
+
+//!
+//! \brief  Per slice progress of the frame being encoded.
+//!         PAK writes the cumulative byte count after each slice, then the number
+//!         of completed slices, so the completed part of the coded buffer can be
+//!         read before the whole frame is done. A new BRC pass first clears the
+//!         number of completed slices, then writes its pass index, and encodes
+//!         the frame again from the start of the coded buffer.
+//!
+struct EncodeStatusSliceProgress
+{
+    uint32_t                        numCompletedSlices;
+    uint32_t                        passIndex;
+    uint32_t                        cumulativeByteCount[ENCODE_STATUS_MAX_PROGRESS_SLICES];
+};
+
 struct LookaheadReport
 {
     uint32_t StatusReportNumber = 0;
@@ -400,6 +418,7 @@ struct EncodeStatusMfx
     uint32_t                        numSkip8x8Block;        //!< Number of skipped 8x8 blocks
     EncodeStatusSliceReport         sliceReport;
     uint32_t                        hucStatus2Reg;          //!< Register value saving HuC Status2
+    EncodeStatusSliceProgress       sliceProgress;          //!< Slice granular progress of the frame
 };
 
 struct EncodeStatusRcs
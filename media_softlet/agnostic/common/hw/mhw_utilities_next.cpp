@@ -26,6 +26,9 @@
 
 #include <math.h>
 #include <set>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "mhw_utilities_next.h"
 #include "mhw_state_heap.h"
 #include "mos_interface.h"
@@ -644,7 +647,7 @@ MOS_STATUS Mhw_SetNearestModeTable(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesY(
+static MOS_STATUS Mhw_GeneratePolyphaseTablesY(
     int32_t         *iCoefs,
     float           fScaleFactor,
     uint32_t        dwPlane,
@@ -793,7 +796,7 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesUV(
+static MOS_STATUS Mhw_GeneratePolyphaseTablesUV(
     int32_t    *piCoefs,
     float      fLanczosT,
     float      fInverseScaleFactor)
@@ -884,7 +887,7 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUV(
 //! \return   MOS_STATUS
 //!           MOS_STATUS_SUCCESS if success, else fail reason
 //!
-MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
+static MOS_STATUS Mhw_GeneratePolyphaseTablesUVOffset(
     int32_t     *piCoefs,
     float       fLanczosT,
     float       fInverseScaleFactor,
@@ -964,6 +967,217 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
     return eStatus;
 }
 
+//!
+//! \brief    Process-wide cache of generated polyphase coefficient tables
+//! \details  Coefficient generation evaluates the lanczos window for every tap of
+//!           every phase, which is costly compared to the table size. SFC, VEBOX and
+//!           sampler AVS setup regenerate the same tables whenever scaling parameters
+//!           are updated (e.g. on dynamic resolution change), so generated tables are
+//!           kept here keyed by every input that affects the result and copied out on hit.
+//!           The scaling ratio is keyed by its exact bit pattern so that cached tables are
+//!           bit exact with freshly generated ones.
+//!
+class MhwPolyphaseTableCache
+{
+public:
+    enum TableType
+    {
+        TABLE_Y = 0,
+        TABLE_UV,
+        TABLE_UV_OFFSET
+    };
+
+    struct Key
+    {
+        uint32_t tableType;
+        uint32_t scaleFactor;       //!< Bit pattern of the scaling factor
+        uint32_t lanczosT;          //!< Bit pattern of the lanczos factor
+        uint32_t hpStrength;        //!< Bit pattern of the high pass strength
+        uint32_t plane;
+        uint32_t srcFormat;
+        uint32_t hwPhase;
+        int32_t  uvPhaseOffset;
+        uint32_t use8x8Filter;
+
+        bool operator<(const Key &other) const
+        {
+            return memcmp(this, &other, sizeof(Key)) < 0;
+        }
+    };
+
+    static MhwPolyphaseTableCache &GetInstance()
+    {
+        static MhwPolyphaseTableCache instance;
+        return instance;
+    }
+
+    static uint32_t FloatBits(float value)
+    {
+        uint32_t bits = 0;
+        MOS_SecureMemcpy(&bits, sizeof(bits), &value, sizeof(value));
+        return bits;
+    }
+
+    //!
+    //! \brief    Copy cached table to coefs
+    //! \return   bool
+    //!           true if table is found in cache, else false
+    //!
+    bool Lookup(const Key &key, int32_t *coefs, uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables.find(key);
+        if (it == m_tables.end() || it->second.size() != count)
+        {
+            return false;
+        }
+        MOS_SecureMemcpy(coefs, count * sizeof(int32_t), it->second.data(), count * sizeof(int32_t));
+        return true;
+    }
+
+    void Insert(const Key &key, const int32_t *coefs, uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tables.size() >= m_maxTableCount)
+        {
+            // Scaling ratios in use are expected to be far fewer than the limit,
+            // so simply start over instead of tracking usage.
+            m_tables.clear();
+        }
+        m_tables[key].assign(coefs, coefs + count);
+    }
+
+private:
+    MhwPolyphaseTableCache() {}
+
+    static const uint32_t                 m_maxTableCount = 512;
+    std::mutex                            m_mutex;
+    std::map<Key, std::vector<int32_t>>   m_tables;
+MEDIA_CLASS_DEFINE_END(MhwPolyphaseTableCache)
+};
+
+//!
+//! \brief      Calculate Polyphase tables for Y , across SFC and Render engine to set the sampler states
+//! \details    Returns the cached table if the same one has been generated before,
+//!             else generates the table with Mhw_GeneratePolyphaseTablesY and caches it.
+//!             Parameters are the same as Mhw_GeneratePolyphaseTablesY.
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesY(
+    int32_t         *iCoefs,
+    float           fScaleFactor,
+    uint32_t        dwPlane,
+    MOS_FORMAT      srcFmt,
+    float           fHPStrength,
+    bool            bUse8x8Filter,
+    uint32_t        dwHwPhase,
+    float           fLanczosT)
+{
+    MHW_CHK_NULL_RETURN(iCoefs);
+
+    MhwPolyphaseTableCache::Key key = {};
+    key.tableType    = MhwPolyphaseTableCache::TABLE_Y;
+    key.scaleFactor  = MhwPolyphaseTableCache::FloatBits(fScaleFactor);
+    key.hpStrength   = MhwPolyphaseTableCache::FloatBits(fHPStrength);
+    key.plane        = dwPlane;
+    key.srcFormat    = (uint32_t)srcFmt;
+    key.hwPhase      = dwHwPhase;
+    key.use8x8Filter = bUse8x8Filter;
+    // fLanczosT is always derived from format and plane for Y tables, so it is not part of the key.
+
+    uint32_t numEntries = (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE) ?
+        NUM_POLYPHASE_Y_ENTRIES : NUM_POLYPHASE_UV_ENTRIES;
+    uint32_t count = numEntries * dwHwPhase;
+
+    MhwPolyphaseTableCache &cache = MhwPolyphaseTableCache::GetInstance();
+    if (cache.Lookup(key, iCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MHW_CHK_STATUS_RETURN(Mhw_GeneratePolyphaseTablesY(
+        iCoefs,
+        fScaleFactor,
+        dwPlane,
+        srcFmt,
+        fHPStrength,
+        bUse8x8Filter,
+        dwHwPhase,
+        fLanczosT));
+
+    cache.Insert(key, iCoefs, count);
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief      Calculate Polyphase tables for UV for Gen9, across SFC and Render engine to set the sampler states
+//! \details    Returns the cached table if the same one has been generated before,
+//!             else generates the table with Mhw_GeneratePolyphaseTablesUV and caches it.
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesUV(
+    int32_t    *piCoefs,
+    float      fLanczosT,
+    float      fInverseScaleFactor)
+{
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    MhwPolyphaseTableCache::Key key = {};
+    key.tableType   = MhwPolyphaseTableCache::TABLE_UV;
+    key.scaleFactor = MhwPolyphaseTableCache::FloatBits(fInverseScaleFactor);
+    key.lanczosT    = MhwPolyphaseTableCache::FloatBits(fLanczosT);
+
+    uint32_t count = MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT;
+
+    MhwPolyphaseTableCache &cache = MhwPolyphaseTableCache::GetInstance();
+    if (cache.Lookup(key, piCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MHW_CHK_STATUS_RETURN(Mhw_GeneratePolyphaseTablesUV(piCoefs, fLanczosT, fInverseScaleFactor));
+
+    cache.Insert(key, piCoefs, count);
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief      Calculate polyphase tables UV offset for Gen9, across SFC and Render engine to set the sampler states
+//! \details    Returns the cached table if the same one has been generated before,
+//!             else generates the table with Mhw_GeneratePolyphaseTablesUVOffset and caches it.
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
+    int32_t     *piCoefs,
+    float       fLanczosT,
+    float       fInverseScaleFactor,
+    int32_t     iUvPhaseOffset)
+{
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    MhwPolyphaseTableCache::Key key = {};
+    key.tableType     = MhwPolyphaseTableCache::TABLE_UV_OFFSET;
+    key.scaleFactor   = MhwPolyphaseTableCache::FloatBits(fInverseScaleFactor);
+    key.lanczosT      = MhwPolyphaseTableCache::FloatBits(fLanczosT);
+    key.uvPhaseOffset = iUvPhaseOffset;
+
+    uint32_t count = MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT;
+
+    MhwPolyphaseTableCache &cache = MhwPolyphaseTableCache::GetInstance();
+    if (cache.Lookup(key, piCoefs, count))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MHW_CHK_STATUS_RETURN(Mhw_GeneratePolyphaseTablesUVOffset(piCoefs, fLanczosT, fInverseScaleFactor, iUvPhaseOffset));
+
+    cache.Insert(key, piCoefs, count);
+    return MOS_STATUS_SUCCESS;
+}
+
 //!
 //! \brief    Allocate BB
 //! \details  Allocated Batch Buffer
@@ -55,6 +55,12 @@ GpuContextMgrNext::~GpuContextMgrNext()
         MosUtilities::MosDestroyMutex(m_gpuContextArrayMutex);
         m_gpuContextArrayMutex = nullptr;
     }
+
+    if (m_statusBufferPoolMutex)
+    {
+        MosUtilities::MosDestroyMutex(m_statusBufferPoolMutex);
+        m_statusBufferPoolMutex = nullptr;
+    }
 }
 
 MOS_STATUS GpuContextMgrNext::Initialize()
@@ -67,6 +73,9 @@ MOS_STATUS GpuContextMgrNext::Initialize()
     m_gpuContextArray.clear();
     MosUtilities::MosUnlockMutex(m_gpuContextArrayMutex);
 
+    m_statusBufferPoolMutex = MosUtilities::MosCreateMutex();
+    MOS_OS_CHK_NULL_RETURN(m_statusBufferPoolMutex);
+
     m_initialized = true;
     return status;
 }
@@ -109,6 +118,8 @@ void GpuContextMgrNext::CleanUp()
         m_gpuContextArray.clear();
         MosUtilities::MosUnlockMutex(m_gpuContextArrayMutex);
 
+        FreeStatusBuffers();
+
         m_initialized = false;
     }
 
@@ -288,3 +299,72 @@ void GpuContextMgrNext::DestroyAllGpuContexts()
 
     MosUtilities::MosUnlockMutex(m_gpuContextArrayMutex);
 }
+
+MOS_RESOURCE_HANDLE GpuContextMgrNext::AcquireStatusBuffer()
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    MOS_RESOURCE_HANDLE statusBuffer = nullptr;
+
+    if (!m_initialized || m_statusBufferPoolMutex == nullptr)
+    {
+        return nullptr;
+    }
+
+    MosUtilities::MosLockMutex(m_statusBufferPoolMutex);
+    if (!m_statusBufferPool.empty())
+    {
+        statusBuffer = m_statusBufferPool.back();
+        m_statusBufferPool.pop_back();
+    }
+    MosUtilities::MosUnlockMutex(m_statusBufferPoolMutex);
+
+    return statusBuffer;
+}
+
+bool GpuContextMgrNext::ReleaseStatusBuffer(MOS_RESOURCE_HANDLE statusBuffer)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    bool retained = false;
+
+    if (statusBuffer == nullptr || statusBuffer->pGfxResourceNext == nullptr ||
+        statusBuffer->pData == nullptr || !m_initialized || m_statusBufferPoolMutex == nullptr)
+    {
+        return false;
+    }
+
+    MosUtilities::MosLockMutex(m_statusBufferPoolMutex);
+    if (m_statusBufferPool.size() < m_maxStatusBufferPoolSize)
+    {
+        m_statusBufferPool.push_back(statusBuffer);
+        retained = true;
+    }
+    MosUtilities::MosUnlockMutex(m_statusBufferPoolMutex);
+
+    return retained;
+}
+
+void GpuContextMgrNext::FreeStatusBuffers()
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    if (m_statusBufferPoolMutex == nullptr)
+    {
+        return;
+    }
+
+    MosUtilities::MosLockMutex(m_statusBufferPoolMutex);
+    for (auto &statusBuffer : m_statusBufferPool)
+    {
+        if (statusBuffer->pGfxResourceNext->Unlock(m_osContext) != MOS_STATUS_SUCCESS)
+        {
+            MOS_OS_ASSERTMESSAGE("failed to unlock the retained gpu status buf");
+        }
+        statusBuffer->pGfxResourceNext->Free(m_osContext, 0);
+        MOS_Delete(statusBuffer->pGfxResourceNext);
+        MOS_FreeMemAndSetNull(statusBuffer);
+    }
+    m_statusBufferPool.clear();
+    MosUtilities::MosUnlockMutex(m_statusBufferPoolMutex);
+}
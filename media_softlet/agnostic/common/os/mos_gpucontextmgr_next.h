@@ -163,6 +163,21 @@ public:
         return m_gpuContextArrayMutex;
     }
 
+    //! \brief    Get a gpu status buffer retained from a destroyed gpu context
+    //! \return   MOS_RESOURCE_HANDLE
+    //!           Locked status buffer if any is retained, otherwise nullptr
+    MOS_RESOURCE_HANDLE AcquireStatusBuffer();
+
+    //! \brief    Retain the gpu status buffer of a destroyed gpu context
+    //! \detail   Buffer must be locked and no longer written by gpu. Gpu contexts
+    //!           created later, by any stream on this device, take it instead of
+    //!           allocating and mapping a new one.
+    //! \param    [in] statusBuffer
+    //!           Status buffer to retain
+    //! \return   bool
+    //!           True if retained, false if caller still owns the buffer
+    bool ReleaseStatusBuffer(MOS_RESOURCE_HANDLE statusBuffer);
+
     //! \brief   Indicate whether new gpu context is inserted into the first slot w/ null ctx handle 
     //!          or always at the end of the gpucontext array
     bool m_noCycledGpuCxtMgmt = false;
@@ -184,6 +199,18 @@ protected:
 
     //! \brief   Flag to indicate gpu context mgr initialized or not
     bool m_initialized = false;
+
+    //! \brief    Free all retained gpu status buffers
+    void FreeStatusBuffers();
+
+    //! \brief    Gpu status buffers retained from destroyed gpu contexts
+    std::vector<MOS_RESOURCE_HANDLE> m_statusBufferPool;
+
+    //! \brief    Status buffer pool mutex
+    PMOS_MUTEX m_statusBufferPoolMutex = nullptr;
+
+    //! \brief    Max number of retained gpu status buffers
+    static const uint32_t m_maxStatusBufferPoolSize = 16;
 MEDIA_CLASS_DEFINE_END(GpuContextMgrNext)
 };
 
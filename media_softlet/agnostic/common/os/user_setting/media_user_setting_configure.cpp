@@ -132,8 +132,7 @@ MOS_STATUS Configure::Read(Value &value,
 {
     int32_t     ret     = 0;
     MOS_STATUS  status  = MOS_STATUS_SUCCESS;
-    auto        &defs   = GetDefinitions(group);
-    auto        def     = defs[MakeHash(valueName)];
+    auto        def     = GetDefinition(valueName, group);
     if (def == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
@@ -145,7 +144,28 @@ MOS_STATUS Configure::Read(Value &value,
         value = useCustomValue ? customValue : def->DefaultValue();
         return MOS_STATUS_SUCCESS;
     }
-    //First, Read user setting. If succeed, return;
+
+    // Internal items are resolved once and read from the published result afterwards,
+    // which needs neither the mutex nor the environment lookup.
+    const Definition::Resolved *resolved = nullptr;
+    if (option == MEDIA_USER_SETTING_INTERNAL)
+    {
+        resolved = def->GetResolved();
+        if (resolved == nullptr)
+        {
+            resolved = Resolve(def);
+        }
+    }
+
+    if (resolved != nullptr)
+    {
+        status = resolved->status;
+        if (status == MOS_STATUS_SUCCESS)
+        {
+            value = resolved->value;
+        }
+    }
+    else
     {
         std::string path = GetReadPath(def, option);
         UFKEY_NEXT  key  = {};
@@ -162,13 +182,6 @@ MOS_STATUS Configure::Read(Value &value,
         m_mutexLock.Unlock();
     }
 
-    //Second, if 1st failed, read envionment variable. External user setting does not set env varaible now.
-    if (status != MOS_STATUS_SUCCESS && option == MEDIA_USER_SETTING_INTERNAL)
-    {
-        // read env variable if no user setting set
-        status = MosUtilities::MosReadEnvVariable(def->ItemEnvName(), defaultType, value);
-    }
-
     if (status != MOS_STATUS_SUCCESS)
     {
         // customValue is only for internal user setting Read
@@ -189,6 +202,66 @@ MOS_STATUS Configure::Read(Value &value,
     return status;
 }
 
+const Definition::Resolved *Configure::Resolve(std::shared_ptr<Definition> def)
+{
+    std::unique_ptr<Definition::Resolved> resolved(new Definition::Resolved{MOS_STATUS_UNKNOWN, Value()});
+    auto defaultType = def->DefaultValue().ValueType();
+
+    //First, Read user setting.
+    {
+        std::string path = GetReadPath(def, MEDIA_USER_SETTING_INTERNAL);
+        UFKEY_NEXT  key  = {};
+
+        m_mutexLock.Lock();
+
+        resolved->status = MosUtilities::MosOpenRegKey(m_rootKey, path, KEY_READ, &key, m_regBufferMap);
+        if (resolved->status == MOS_STATUS_SUCCESS)
+        {
+            resolved->status = MosUtilities::MosGetRegValue(key, def->ItemName(), defaultType, resolved->value, m_regBufferMap);
+            MosUtilities::MosCloseRegKey(key);
+        }
+
+        m_mutexLock.Unlock();
+    }
+
+    //Second, if 1st failed, read envionment variable. External user setting does not set env varaible now.
+    if (resolved->status != MOS_STATUS_SUCCESS)
+    {
+        resolved->status = MosUtilities::MosReadEnvVariable(def->ItemEnvName(), defaultType, resolved->value);
+    }
+
+    // Results are only released with the configure, so readers holding an older result stay valid.
+    m_mutexLock.Lock();
+    const Definition::Resolved *published = def->GetResolved();
+    if (published == nullptr)
+    {
+        published = resolved.get();
+        m_resolvedPool.push_back(std::move(resolved));
+        def->SetResolved(published);
+    }
+    m_mutexLock.Unlock();
+
+    return published;
+}
+
+MOS_STATUS Configure::Refresh()
+{
+    m_mutexLock.Lock();
+    for (auto &defs : m_definitions)
+    {
+        for (auto &it : defs)
+        {
+            if (it.second != nullptr)
+            {
+                it.second->SetResolved(nullptr);
+            }
+        }
+    }
+    m_mutexLock.Unlock();
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS Configure::Write(
     const std::string &valueName,
     const Value &value,
@@ -196,9 +269,7 @@ MOS_STATUS Configure::Write(
     bool isForReport,
     uint32_t option)
 {
-    auto &defs = GetDefinitions(group);
-
-    auto def = defs[MakeHash(valueName)];
+    auto def = GetDefinition(valueName, group);
     if (def == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
@@ -214,6 +285,12 @@ MOS_STATUS Configure::Write(
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
+    // Most items are reported with the same value every frame, skip rewriting it.
+    if (option == MEDIA_USER_SETTING_INTERNAL && def->IsLastReported(value))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
     std::string path = GetReportPath(def, option);
 
     UFKEY_NEXT key = {};
@@ -228,6 +305,16 @@ MOS_STATUS Configure::Write(
 
         MosUtilities::MosCloseRegKey(key);
     }
+
+    if (status == MOS_STATUS_SUCCESS && option == MEDIA_USER_SETTING_INTERNAL)
+    {
+        def->SetLastReported(value);
+        if (path == def->GetSubPath())
+        {
+            // The item is read from the path just written, resolve it again on next read.
+            def->SetResolved(nullptr);
+        }
+    }
     m_mutexLock.Unlock();
 
     if (status != MOS_STATUS_SUCCESS)
@@ -2395,10 +2395,11 @@ int32_t RenderHal_LoadKernel(
             }
         }
 
-        // Did not find block, try to deallocate a kernel not recently used
+        // Did not find block, try to deallocate a kernel not recently or frequently used
         if (iSearchIndex < 0)
         {
-            uint32_t dwOldest = 0;
+            uint32_t dwOldest         = 0;
+            uint32_t dwOldestUseCount = 0;
             uint32_t dwLastUsed;
 
             // Search and deallocate least used kernel
@@ -2422,14 +2423,21 @@ int32_t RenderHal_LoadKernel(
                     continue;
                 }
 
-                // Find kernel not used for the greater amount of time (measured in number of operations)
+                // Find kernel not used for the greater amount of time (measured in number of operations),
+                // weighted by how often it was used, so that hot kernels rotating with others stay resident
                 // Must not unload recently allocated kernels
                 dwLastUsed = (uint32_t)(pStateHeap->dwAccessCounter - pKernelAllocation->dwCount);
-                if (dwLastUsed > dwOldest)
+                if (dwLastUsed > 0 &&
+                    (uint64_t)dwLastUsed * ((uint64_t)dwOldestUseCount + 1) >
+                    (uint64_t)dwOldest * ((uint64_t)pKernelAllocation->dwUseCount + 1))
                 {
-                    iSearchIndex = iKernelAllocationID;
-                    dwOldest     = dwLastUsed;
+                    iSearchIndex     = iKernelAllocationID;
+                    dwOldest         = dwLastUsed;
+                    dwOldestUseCount = pKernelAllocation->dwUseCount;
                 }
+
+                // Age usage, so that kernels no longer used are eventually evicted
+                pKernelAllocation->dwUseCount >>= 1;
             }
 
             // Did not found any entry for deallocation
@@ -2440,6 +2448,13 @@ int32_t RenderHal_LoadKernel(
                 break;
             }
 
+            MHW_RENDERHAL_VERBOSEMESSAGE("Evict kernel KUID %d KCID %d, %d uses, for KUID %d KCID %d.",
+                pStateHeap->pKernelAllocation[iSearchIndex].iKUID,
+                pStateHeap->pKernelAllocation[iSearchIndex].iKCID,
+                dwOldestUseCount,
+                iKernelUniqueID,
+                iKernelCacheID);
+
             // Free kernel entry and states associated with the kernel (if any)
             if (pRenderHal->pfnUnloadKernel(pRenderHal, iSearchIndex) != MOS_STATUS_SUCCESS)
             {
@@ -2447,6 +2462,7 @@ int32_t RenderHal_LoadKernel(
                 iKernelAllocationID = RENDERHAL_KERNEL_LOAD_FAIL;
                 break;
             }
+            pStateHeap->dwKernelEvictions++;
         }
 
         // Allocate the entry
@@ -2467,6 +2483,7 @@ int32_t RenderHal_LoadKernel(
         pKernelAllocation->iSize        = iSize;
         pKernelAllocation->dwFlags      = RENDERHAL_KERNEL_ALLOCATION_USED;
         pKernelAllocation->dwCount      = 0;  // will be updated by "TouchKernel"
+        pKernelAllocation->dwUseCount   = 0;
         pKernelAllocation->Params       = *pParameters;
         pKernelAllocation->pKernelEntry = pKernelEntry;
         pKernelAllocation->iAllocIndex  = iKernelAllocationID;
@@ -2477,6 +2494,10 @@ int32_t RenderHal_LoadKernel(
         {
             MOS_ZeroMemory(pStateHeap->pIshBuffer + dwOffset + iKernelSize, iSize - iKernelSize);
         }
+
+        pStateHeap->dwKernelLoads++;
+        MHW_RENDERHAL_VERBOSEMESSAGE("Load kernel KUID %d KCID %d, %d loads and %d evictions in ISH.",
+            iKernelUniqueID, iKernelCacheID, pStateHeap->dwKernelLoads, pStateHeap->dwKernelEvictions);
     } while (false);
 
 
@@ -2599,6 +2620,10 @@ void RenderHal_TouchKernel(
         pKernelAllocation->dwFlags != RENDERHAL_KERNEL_ALLOCATION_LOCKED)
     {
         pKernelAllocation->dwCount = pStateHeap->dwAccessCounter++;
+        if (pKernelAllocation->dwUseCount < UINT32_MAX)
+        {
+            pKernelAllocation->dwUseCount++;
+        }
     }
 
     // Set sync tag, for deallocation control
@@ -2923,6 +2948,202 @@ uint32_t RenderHal_SetSurfacesPerBT(PRENDERHAL_INTERFACE pRenderHal, uint32_t dw
     return dwSurfacesPerBT;
 }
 
+//!
+//! \brief    Flush Surface State Cache
+//! \details  Drops surface states cached for the previous SSH instance and
+//!           reports how many setups were served from the cache
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \return   void
+//!
+static void RenderHal_FlushSurfaceStateCache(
+    PRENDERHAL_INTERFACE pRenderHal)
+{
+    PRENDERHAL_SURFACE_STATE_CACHE pCache = pRenderHal->pSurfaceStateCache;
+
+    if (pCache == nullptr || pCache->dwLookups == 0)
+    {
+        return;
+    }
+
+    MHW_RENDERHAL_VERBOSEMESSAGE("Surface state cache: %d hits in %d lookups.",
+        pCache->dwHits, pCache->dwLookups);
+
+    pCache->iCount    = 0;
+    pCache->iNext     = 0;
+    pCache->dwLookups = 0;
+    pCache->dwHits    = 0;
+}
+
+//!
+//! \brief    Lookup Surface State Cache
+//! \details  Returns the surface state entries already set up in the current
+//!           SSH instance for the same surface and params. On a miss, reserves
+//!           a cache entry keyed by the inputs, to be completed after setup
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \param    PRENDERHAL_SURFACE pRenderHalSurface
+//!           [in/out] Pointer to RenderHal Surface
+//! \param    PRENDERHAL_SURFACE_STATE_PARAMS pParams
+//!           [in/out] Pointer to Surface State Params
+//! \param    int32_t *piNumEntries
+//!           [out] Number of Surface State Entries
+//! \param    PRENDERHAL_SURFACE_STATE_ENTRY *ppSurfaceEntries
+//!           [out] Array of Surface State Entries
+//! \param    PRENDERHAL_OFFSET_OVERRIDE pOffsetOverride
+//!           [in] If not nullptr, provides adjustments to Y, UV plane offsets
+//! \param    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY *ppCacheEntry
+//!           [out] Reserved cache entry on a miss, nullptr if not cacheable
+//! \return   bool
+//!           true if the entries were found in the cache
+//!
+static bool RenderHal_LookupSurfaceStateCache(
+    PRENDERHAL_INTERFACE                 pRenderHal,
+    PRENDERHAL_SURFACE                   pRenderHalSurface,
+    PRENDERHAL_SURFACE_STATE_PARAMS      pParams,
+    int32_t                              *piNumEntries,
+    PRENDERHAL_SURFACE_STATE_ENTRY       *ppSurfaceEntries,
+    PRENDERHAL_OFFSET_OVERRIDE           pOffsetOverride,
+    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY *ppCacheEntry)
+{
+    PRENDERHAL_SURFACE_STATE_CACHE       pCache;
+    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY pEntry;
+    PRENDERHAL_STATE_HEAP                pStateHeap;
+    int32_t                              i, j;
+
+    *ppCacheEntry = nullptr;
+    pStateHeap    = pRenderHal->pStateHeap;
+    if (pStateHeap == nullptr || pStateHeap->pSurfaceEntry == nullptr ||
+        pRenderHalSurface == nullptr || pParams == nullptr ||
+        piNumEntries == nullptr || ppSurfaceEntries == nullptr)
+    {
+        return false;
+    }
+
+    if (pRenderHal->pSurfaceStateCache == nullptr)
+    {
+        // Cache is an optimization only, surface setup works without it
+        pRenderHal->pSurfaceStateCache = (PRENDERHAL_SURFACE_STATE_CACHE)MOS_AllocAndZeroMemory(
+            sizeof(RENDERHAL_SURFACE_STATE_CACHE));
+        if (pRenderHal->pSurfaceStateCache == nullptr)
+        {
+            return false;
+        }
+    }
+    pCache = pRenderHal->pSurfaceStateCache;
+    pCache->dwLookups++;
+
+    for (i = 0; i < pCache->iCount; i++)
+    {
+        pEntry = &pCache->Entries[i];
+
+        if (pEntry->iNumEntries == 0 ||
+            pEntry->bOffsetOverride != (pOffsetOverride != nullptr) ||
+            (pOffsetOverride &&
+             memcmp(&pEntry->OffsetOverride, pOffsetOverride, sizeof(RENDERHAL_OFFSET_OVERRIDE))) ||
+            memcmp(&pEntry->ParamsIn, pParams, sizeof(RENDERHAL_SURFACE_STATE_PARAMS)) ||
+            memcmp(&pEntry->SurfaceIn, pRenderHalSurface, sizeof(RENDERHAL_SURFACE)))
+        {
+            continue;
+        }
+
+        // Entries are only valid while still assigned in this SSH instance
+        for (j = 0; j < pEntry->iNumEntries; j++)
+        {
+            if (pEntry->iSurfStateID[j] >= pStateHeap->iCurrentSurfaceState)
+            {
+                break;
+            }
+        }
+        if (j < pEntry->iNumEntries)
+        {
+            break;
+        }
+
+        for (j = 0; j < pEntry->iNumEntries; j++)
+        {
+            ppSurfaceEntries[j] = &pStateHeap->pSurfaceEntry[pEntry->iSurfStateID[j]];
+        }
+        *piNumEntries      = pEntry->iNumEntries;
+        *pRenderHalSurface = pEntry->SurfaceOut;
+        *pParams           = pEntry->ParamsOut;
+
+        pCache->dwHits++;
+        return true;
+    }
+
+    // Reuse the stale entry if one matched, otherwise replace round robin
+    if (i < pCache->iCount)
+    {
+        pEntry = &pCache->Entries[i];
+    }
+    else if (pCache->iCount < RENDERHAL_SURFACE_STATE_CACHE_SIZE)
+    {
+        pEntry = &pCache->Entries[pCache->iCount++];
+    }
+    else
+    {
+        pEntry        = &pCache->Entries[pCache->iNext];
+        pCache->iNext = (pCache->iNext + 1) % RENDERHAL_SURFACE_STATE_CACHE_SIZE;
+    }
+
+    pEntry->iNumEntries     = 0;
+    pEntry->SurfaceIn       = *pRenderHalSurface;
+    pEntry->ParamsIn        = *pParams;
+    pEntry->bOffsetOverride = (pOffsetOverride != nullptr);
+    if (pOffsetOverride)
+    {
+        pEntry->OffsetOverride = *pOffsetOverride;
+    }
+
+    *ppCacheEntry = pEntry;
+    return false;
+}
+
+//!
+//! \brief    Update Surface State Cache
+//! \details  Completes the cache entry reserved by lookup with the result of setup
+//! \param    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY pCacheEntry
+//!           [in] Reserved cache entry, may be nullptr
+//! \param    PRENDERHAL_SURFACE pRenderHalSurface
+//!           [in] Pointer to RenderHal Surface after setup
+//! \param    PRENDERHAL_SURFACE_STATE_PARAMS pParams
+//!           [in] Pointer to Surface State Params after setup
+//! \param    int32_t *piNumEntries
+//!           [in] Number of Surface State Entries
+//! \param    PRENDERHAL_SURFACE_STATE_ENTRY *ppSurfaceEntries
+//!           [in] Array of Surface State Entries
+//! \return   void
+//!
+static void RenderHal_UpdateSurfaceStateCache(
+    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY pCacheEntry,
+    PRENDERHAL_SURFACE                   pRenderHalSurface,
+    PRENDERHAL_SURFACE_STATE_PARAMS      pParams,
+    int32_t                              *piNumEntries,
+    PRENDERHAL_SURFACE_STATE_ENTRY       *ppSurfaceEntries)
+{
+    int32_t i;
+
+    if (pCacheEntry == nullptr ||
+        *piNumEntries <= 0 || *piNumEntries > MHW_MAX_SURFACE_PLANES)
+    {
+        return;
+    }
+
+    for (i = 0; i < *piNumEntries; i++)
+    {
+        if (ppSurfaceEntries[i] == nullptr)
+        {
+            return;
+        }
+        pCacheEntry->iSurfStateID[i] = ppSurfaceEntries[i]->iSurfStateID;
+    }
+
+    pCacheEntry->SurfaceOut  = *pRenderHalSurface;
+    pCacheEntry->ParamsOut   = *pParams;
+    pCacheEntry->iNumEntries = *piNumEntries;
+}
+
 //!
 //! \brief    Assign Surface State
 //! \details  Assign a new surface state from already allocated surfState pool
@@ -2955,6 +3176,12 @@ MOS_STATUS RenderHal_AssignSurfaceState(
     eStatus    = MOS_STATUS_UNKNOWN;
     pStateHeap = pRenderHal->pStateHeap;
 
+    // First surface state of a new SSH instance, previous states are gone
+    if (pStateHeap->iCurrentSurfaceState == 0)
+    {
+        RenderHal_FlushSurfaceStateCache(pRenderHal);
+    }
+
     if (pStateHeap->iCurrentSurfaceState >= pRenderHal->StateHeapSettings.iSurfaceStates)
     {
         MHW_RENDERHAL_ASSERTMESSAGE("Unable to allocate Surface State. Exceeds Maximum.");
@@ -4556,6 +4783,11 @@ MOS_STATUS RenderHal_Destroy(PRENDERHAL_INTERFACE pRenderHal)
     // Destroy MHW Render Interface
     pRenderHal->pRenderHalPltInterface->DestoryMhwInterface(pRenderHal);
 
+    // Release Surface State Cache
+    RenderHal_FlushSurfaceStateCache(pRenderHal);
+    MOS_SafeFreeMemory(pRenderHal->pSurfaceStateCache);
+    pRenderHal->pSurfaceStateCache = nullptr;
+
     // Release pBatchBufferMemPool
     if (pRenderHal->pBatchBufferMemPool)
     {
@@ -6424,8 +6656,9 @@ MOS_STATUS RenderHal_SetupSurfaceState(
     PRENDERHAL_SURFACE_STATE_ENTRY  *ppSurfaceEntries,
     PRENDERHAL_OFFSET_OVERRIDE      pOffsetOverride)
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-    
+    MOS_STATUS                           eStatus     = MOS_STATUS_SUCCESS;
+    PRENDERHAL_SURFACE_STATE_CACHE_ENTRY pCacheEntry = nullptr;
+
     //-----------------------------------------------
     MHW_RENDERHAL_CHK_NULL_RETURN(pRenderHal);
     MHW_RENDERHAL_CHK_NULL_RETURN(pRenderHal->pRenderHalPltInterface);
@@ -6448,9 +6681,20 @@ MOS_STATUS RenderHal_SetupSurfaceState(
     {
         MHW_RENDERHAL_NORMALMESSAGE("Not implemented yet! Will use MemObjCtl value %d", pParams->MemObjCtl);
     }
+
+    // Same surface with same params already set up in this SSH instance
+    if (RenderHal_LookupSurfaceStateCache(
+            pRenderHal, pRenderHalSurface, pParams, piNumEntries, ppSurfaceEntries, pOffsetOverride, &pCacheEntry))
+    {
+        return eStatus;
+    }
+
     MHW_RENDERHAL_CHK_STATUS_RETURN(pRenderHal->pRenderHalPltInterface->SetupSurfaceState(
         pRenderHal, pRenderHalSurface, pParams, piNumEntries, ppSurfaceEntries, pOffsetOverride));
 
+    RenderHal_UpdateSurfaceStateCache(
+        pCacheEntry, pRenderHalSurface, pParams, piNumEntries, ppSurfaceEntries);
+
     return eStatus;
 }
 
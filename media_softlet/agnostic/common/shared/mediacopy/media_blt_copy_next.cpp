@@ -27,6 +27,7 @@
 
 #define NOMINMAX
 #include <algorithm>
+#include <vector>
 #include "media_perf_profiler.h"
 #include "media_blt_copy_next.h"
 #define BIT( n )                            ( 1 << (n) )
@@ -672,6 +673,77 @@ MOS_STATUS BltStateNext::CopyMainSurface(
 
 }
 
+//!
+//! \brief    Copy main surfaces
+//! \details  BLT engine will copy a batch of source surfaces to destination surfaces in order,
+//!           recording up to BLT_MAX_BATCH_COPIES copies in each command buffer.
+//!           If a submission fails, the copies submitted before it still execute.
+//! \param    src
+//!           [in] Pointer to array of source resources
+//! \param    dst
+//!           [in] Pointer to array of destination resources
+//! \param    count
+//!           [in] Number of copies
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::CopyMainSurfaces(
+    PMOS_RESOURCE *src,
+    PMOS_RESOURCE *dst,
+    uint32_t       count)
+{
+    std::vector<BLT_STATE_PARAM> bltStateParams;
+
+    BLT_CHK_NULL_RETURN(src);
+    BLT_CHK_NULL_RETURN(dst);
+    MOS_TraceEventExt(EVENT_MEDIA_COPY, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        BLT_CHK_NULL_RETURN(src[i]);
+        BLT_CHK_NULL_RETURN(dst[i]);
+        BLT_CHK_NULL_RETURN(src[i]->pGmmResInfo);
+        BLT_CHK_NULL_RETURN(dst[i]->pGmmResInfo);
+
+        BLT_STATE_PARAM bltStateParam;
+        MOS_ZeroMemory(&bltStateParam, sizeof(BLT_STATE_PARAM));
+        bltStateParam.bCopyMainSurface = true;
+        bltStateParam.pSrcSurface      = src[i];
+        bltStateParam.pDstSurface      = dst[i];
+
+        // oversized buffers override gmm info for the copy, keep them in their own submission.
+        // Submit the copies recorded so far first to keep the copies in order.
+        if (m_blokCopyon &&
+            (src[i]->pGmmResInfo->GetResourceType() == RESOURCE_BUFFER) &&
+            (dst[i]->pGmmResInfo->GetResourceType() == RESOURCE_BUFFER) &&
+            ((src[i]->pGmmResInfo->GetBaseWidth() > MAX_BLT_BLOCK_COPY_WIDTH) || (dst[i]->pGmmResInfo->GetBaseWidth() > MAX_BLT_BLOCK_COPY_WIDTH)))
+        {
+            if (!bltStateParams.empty())
+            {
+                BLT_CHK_STATUS_RETURN(SubmitBatchCMD(bltStateParams.data(), (uint32_t)bltStateParams.size()));
+                bltStateParams.clear();
+            }
+            BLT_CHK_STATUS_RETURN(BlockCopyBuffer(&bltStateParam));
+            continue;
+        }
+
+        bltStateParams.push_back(bltStateParam);
+        if (bltStateParams.size() == BLT_MAX_BATCH_COPIES)
+        {
+            BLT_CHK_STATUS_RETURN(SubmitBatchCMD(bltStateParams.data(), (uint32_t)bltStateParams.size()));
+            bltStateParams.clear();
+        }
+    }
+
+    if (!bltStateParams.empty())
+    {
+        BLT_CHK_STATUS_RETURN(SubmitBatchCMD(bltStateParams.data(), (uint32_t)bltStateParams.size()));
+    }
+
+    MOS_TraceEventExt(EVENT_MEDIA_COPY, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+    return MOS_STATUS_SUCCESS;
+}
+
 //!
 //! \brief    Setup fast copy parameters
 //! \details  Setup fast copy parameters for BLT Engine
@@ -813,13 +885,29 @@ MOS_STATUS BltStateNext::SetupBltCopyParam(
 MOS_STATUS BltStateNext::SubmitCMD(
     PBLT_STATE_PARAM pBltStateParam)
 {
-    MOS_STATUS                   eStatus;
+    BLT_CHK_STATUS_RETURN(SubmitBatchCMD(pBltStateParam, 1));
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief    Submit batched command
+//! \details  Record BLT copy commands of all params into one command buffer and submit once.
+//!           Copies are separated by MI_FLUSH_DW so that they complete in order.
+//! \param    pBltStateParams
+//!           [in] Pointer to array of BLT_STATE_PARAM
+//! \param    count
+//!           [in] Number of params
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::SubmitBatchCMD(
+    PBLT_STATE_PARAM pBltStateParams,
+    uint32_t         count)
+{
     MOS_COMMAND_BUFFER           cmdBuffer;
-    MHW_FAST_COPY_BLT_PARAM      fastCopyBltParam;
-    MHW_CTRL_SURF_COPY_BLT_PARAM ctrlSurfCopyBltParam;
     MOS_GPUCTX_CREATOPTIONS_ENHANCED createOption = {};
-    int                          planeNum = 1;
 
+    BLT_CHK_NULL_RETURN(pBltStateParams);
     BLT_CHK_NULL_RETURN(m_miItf);
     BLT_CHK_NULL_RETURN(m_bltItf);
 
@@ -840,6 +928,78 @@ MOS_STATUS BltStateNext::SubmitCMD(
     MOS_ZeroMemory(&cmdBuffer, sizeof(MOS_COMMAND_BUFFER));
     BLT_CHK_STATUS_RETURN(m_osInterface->pfnGetCommandBuffer(m_osInterface, &cmdBuffer, 0));
 
+    m_osInterface->pfnSetPerfTag(m_osInterface, BLT_COPY);
+    MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
+    BLT_CHK_NULL_RETURN(perfProfiler);
+    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (i > 0)
+        {
+            // A copy may read the destination of a previous one, flush the previous copy first
+            auto& copyFlushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+            copyFlushDwParams = {};
+            BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+        }
+        BLT_CHK_STATUS_RETURN(AddCopyMainSurfaceCmds(&cmdBuffer, &pBltStateParams[i]));
+    }
+
+    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectEndCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
+
+    // Get GPU Status buffer
+    PMOS_RESOURCE gpuStatusBuffer = nullptr;
+    BLT_CHK_STATUS_RETURN(m_osInterface->pfnGetGpuStatusBufferResource(m_osInterface, gpuStatusBuffer));
+    BLT_CHK_NULL_RETURN(gpuStatusBuffer);
+    // Register the buffer
+    BLT_CHK_STATUS_RETURN(m_osInterface->pfnRegisterResource(m_osInterface, gpuStatusBuffer, true, true));
+
+    // Add flush DW, writing back GPU status tag so media copy can track outstanding BLT work
+    auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
+    flushDwParams = {};
+    flushDwParams.pOsResource      = gpuStatusBuffer;
+    flushDwParams.dwResourceOffset = m_osInterface->pfnGetGpuStatusTagOffset(m_osInterface, MOS_GPU_CONTEXT_BLT);
+    flushDwParams.dwDataDW1        = m_osInterface->pfnGetGpuStatusTag(m_osInterface, MOS_GPU_CONTEXT_BLT);
+    auto skuTable       = m_osInterface->pfnGetSkuTable(m_osInterface);
+    if (skuTable && MEDIA_IS_SKU(skuTable, FtrEnablePPCFlush))
+    {
+         flushDwParams.bEnablePPCFlush = true;
+    }
+    BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+    // Increase buffer tag for next usage
+    m_osInterface->pfnIncrementGpuStatusTag(m_osInterface, MOS_GPU_CONTEXT_BLT);
+    // Add Batch Buffer end
+    BLT_CHK_STATUS_RETURN(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
+
+    // Return unused command buffer space to OS
+    m_osInterface->pfnReturnCommandBuffer(m_osInterface, &cmdBuffer, 0);
+
+    // Flush the command buffer
+    BLT_CHK_STATUS_RETURN(m_osInterface->pfnSubmitCommandBuffer(m_osInterface, &cmdBuffer, false));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief    Add copy main surface commands
+//! \details  Add BLT commands copying every plane of source surface to destination surface
+//! \param    cmdBuffer
+//!           [in] Pointer to command buffer
+//! \param    pBltStateParam
+//!           [in] Pointer to BLT_STATE_PARAM
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+//!
+MOS_STATUS BltStateNext::AddCopyMainSurfaceCmds(
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    PBLT_STATE_PARAM    pBltStateParam)
+{
+    MHW_FAST_COPY_BLT_PARAM      fastCopyBltParam;
+    int                          planeNum = 1;
+
+    BLT_CHK_NULL_RETURN(cmdBuffer);
+    BLT_CHK_NULL_RETURN(pBltStateParam);
+
     MOS_SURFACE       srcResDetails;
     MOS_SURFACE       dstResDetails;
     MOS_ZeroMemory(&srcResDetails, sizeof(MOS_SURFACE));
@@ -855,11 +1015,6 @@ MOS_STATUS BltStateNext::SubmitCMD(
         return MOS_STATUS_INVALID_PARAMETER;
     }
     planeNum = GetPlaneNum(dstResDetails.Format);
-    m_osInterface->pfnSetPerfTag(m_osInterface, BLT_COPY);
-    MediaPerfProfiler* perfProfiler = MediaPerfProfiler::Instance();
-    BLT_CHK_NULL_RETURN(perfProfiler);
-    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectStartCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
-
     if (pBltStateParam->bCopyMainSurface)
     {
         BLT_CHK_STATUS_RETURN(SetupBltCopyParam(
@@ -881,12 +1036,12 @@ MOS_STATUS BltStateNext::SubmitCMD(
             swctrl.DW0.Tile4Destination = 1;
         }
         Register.dwData = swctrl.DW0.Value;
-        BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_LOAD_REGISTER_IMM)(&cmdBuffer));
+        BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_LOAD_REGISTER_IMM)(cmdBuffer));
 
         if (m_blokCopyon)
         {
             BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                &cmdBuffer,
+                cmdBuffer,
                 &fastCopyBltParam,
                 srcResDetails.YPlaneOffset.iSurfaceOffset,
                 dstResDetails.YPlaneOffset.iSurfaceOffset));
@@ -894,7 +1049,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
         else
         {
             BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                &cmdBuffer,
+                cmdBuffer,
                 &fastCopyBltParam,
                 srcResDetails.YPlaneOffset.iSurfaceOffset,
                 dstResDetails.YPlaneOffset.iSurfaceOffset));
@@ -909,7 +1064,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
             if (m_blokCopyon)
             {
                 BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                    &cmdBuffer,
+                    cmdBuffer,
                     &fastCopyBltParam,
                     srcResDetails.UPlaneOffset.iSurfaceOffset,
                     dstResDetails.UPlaneOffset.iSurfaceOffset));
@@ -917,7 +1072,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
             else
             {
                 BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                    &cmdBuffer,
+                    cmdBuffer,
                     &fastCopyBltParam,
                     srcResDetails.UPlaneOffset.iSurfaceOffset,
                     dstResDetails.UPlaneOffset.iSurfaceOffset));
@@ -932,7 +1087,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
                 if (m_blokCopyon)
                 {
                     BLT_CHK_STATUS_RETURN(m_bltItf->AddBlockCopyBlt(
-                        &cmdBuffer,
+                        cmdBuffer,
                         &fastCopyBltParam,
                         srcResDetails.VPlaneOffset.iSurfaceOffset,
                         dstResDetails.VPlaneOffset.iSurfaceOffset));
@@ -940,7 +1095,7 @@ MOS_STATUS BltStateNext::SubmitCMD(
                 else
                 {
                     BLT_CHK_STATUS_RETURN(m_bltItf->AddFastCopyBlt(
-                        &cmdBuffer,
+                        cmdBuffer,
                         &fastCopyBltParam,
                         srcResDetails.VPlaneOffset.iSurfaceOffset,
                         dstResDetails.VPlaneOffset.iSurfaceOffset));
@@ -953,25 +1108,6 @@ MOS_STATUS BltStateNext::SubmitCMD(
             }
          }
     }
-    BLT_CHK_STATUS_RETURN(perfProfiler->AddPerfCollectEndCmd((void*)this, m_osInterface, m_miItf, &cmdBuffer));
-
-    // Add flush DW
-    auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
-    flushDwParams = {};
-    auto skuTable       = m_osInterface->pfnGetSkuTable(m_osInterface);
-    if (skuTable && MEDIA_IS_SKU(skuTable, FtrEnablePPCFlush))
-    {
-         flushDwParams.bEnablePPCFlush = true;
-    }
-    BLT_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
-    // Add Batch Buffer end
-    BLT_CHK_STATUS_RETURN(m_miItf->AddMiBatchBufferEnd(&cmdBuffer, nullptr));
-
-    // Return unused command buffer space to OS
-    m_osInterface->pfnReturnCommandBuffer(m_osInterface, &cmdBuffer, 0);
-
-    // Flush the command buffer
-    BLT_CHK_STATUS_RETURN(m_osInterface->pfnSubmitCommandBuffer(m_osInterface, &cmdBuffer, false));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -85,6 +85,25 @@ public:
         PMOS_RESOURCE src,
         PMOS_RESOURCE dst);
 
+    //!
+    //! \brief    Copy main surfaces
+    //! \details  BLT engine will copy a batch of source surfaces to destination surfaces
+    //!           in order, with one submission per BLT_MAX_BATCH_COPIES copies. If a
+    //!           submission fails, the copies submitted before it still execute.
+    //! \param    src
+    //!           [in] Pointer to array of source resources
+    //! \param    dst
+    //!           [in] Pointer to array of destination resources
+    //! \param    count
+    //!           [in] Number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS CopyMainSurfaces(
+        PMOS_RESOURCE *src,
+        PMOS_RESOURCE *dst,
+        uint32_t       count);
+
     //!
     //! \brief    Setup blt copy parameters
     //! \details  Setup blt copy parameters for BLT Engine
@@ -116,6 +135,21 @@ public:
     virtual MOS_STATUS SubmitCMD(
         PBLT_STATE_PARAM pBltStateParam);
 
+    //!
+    //! \brief    Submit batched command
+    //! \details  Record BLT copy commands of all params into one command buffer and submit once.
+    //!           Copies are separated by MI_FLUSH_DW so that they complete in order.
+    //! \param    pBltStateParams
+    //!           [in] Pointer to array of BLT_STATE_PARAM
+    //! \param    count
+    //!           [in] Number of params
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS SubmitBatchCMD(
+        PBLT_STATE_PARAM pBltStateParams,
+        uint32_t         count);
+
     //!
     //! \brief    Get Block copy color depth.
     //! \details  get different format's color depth.
@@ -319,6 +353,20 @@ protected:
     MOS_STATUS BlockCopyBuffer(
         PBLT_STATE_PARAM pBltStateParam);
 
+    //!
+    //! \brief    Add copy main surface commands
+    //! \details  Add BLT commands copying every plane of source surface to destination surface
+    //! \param    cmdBuffer
+    //!           [in] Pointer to command buffer
+    //! \param    pBltStateParam
+    //!           [in] Pointer to BLT_STATE_PARAM
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS AddCopyMainSurfaceCmds(
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        PBLT_STATE_PARAM    pBltStateParam);
+
 public:
     bool               m_blokCopyon       = false;
     PMOS_INTERFACE     m_osInterface      = nullptr;
@@ -31,6 +31,7 @@
 #include "mhw_cp_interface.h"
 #include "mos_utilities.h"
 #include "mos_util_debug.h"
+#include <vector>
 
 #define BLT_MAX_WIDTH  (1 << 16) - 1
 #define BLT_MAX_HEIGHT (1 << 16) - 1
@@ -42,6 +43,8 @@
 #define RENDER_MIN_WIDTH  16
 #define RENDER_MIN_HEIGHT 16
 
+#define MCPY_MAX_ENGINE_LOAD 1024
+
 MediaCopyBaseState::MediaCopyBaseState():
     m_osInterface(nullptr)
 {
@@ -189,8 +192,12 @@ MOS_STATUS MediaCopyBaseState::CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_E
     switch (preferMethod)
     {
         case MCPY_METHOD_PERFORMANCE:
+            mcpyEngine = caps.engineRender?MCPY_ENGINE_RENDER:(caps.engineBlt ? MCPY_ENGINE_BLT : MCPY_ENGINE_VEBOX);
+            break;
         case MCPY_METHOD_DEFAULT:
+            // no engine preference from caller, avoid queuing behind earlier copies on a busy engine.
             mcpyEngine = caps.engineRender?MCPY_ENGINE_RENDER:(caps.engineBlt ? MCPY_ENGINE_BLT : MCPY_ENGINE_VEBOX);
+            mcpyEngine = SelectLeastLoadedEngine(mcpyEngine, caps);
             break;
         case MCPY_METHOD_BALANCE:
             mcpyEngine = caps.engineVebox?MCPY_ENGINE_VEBOX:(caps.engineBlt?MCPY_ENGINE_BLT:MCPY_ENGINE_RENDER);
@@ -222,6 +229,67 @@ MOS_STATUS MediaCopyBaseState::CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_E
     return MOS_STATUS_SUCCESS;
 }
 
+uint32_t MediaCopyBaseState::GetEngineLoad(MCPY_ENGINE mcpyEngine)
+{
+    if (m_osInterface == nullptr || mcpyEngine > MCPY_ENGINE_RENDER)
+    {
+        return 0;
+    }
+
+    MOS_GPU_CONTEXT gpuContext = m_engineGpuContext[mcpyEngine];
+    if (gpuContext >= MOS_GPU_CONTEXT_MAX ||
+        m_osInterface->pfnGetGpuStatusTag == nullptr ||
+        m_osInterface->pfnGetGpuStatusSyncTag == nullptr)
+    {
+        return 0; // engine not used by media copy yet.
+    }
+
+    // status tag is the next tag to be written, sync tag is the last one written back by GPU.
+    uint32_t nextTag = m_osInterface->pfnGetGpuStatusTag(m_osInterface, gpuContext);
+    uint32_t syncTag = m_osInterface->pfnGetGpuStatusSyncTag(m_osInterface, gpuContext);
+    uint32_t pending = nextTag - syncTag - 1;
+
+    // tag wraps from UINT_MAX to 1, and a stale sync tag may run ahead after context recreation.
+    return (pending > MCPY_MAX_ENGINE_LOAD) ? 0 : pending;
+}
+
+MCPY_ENGINE MediaCopyBaseState::SelectLeastLoadedEngine(MCPY_ENGINE preferEngine, MCPY_ENGINE_CAPS &caps)
+{
+    bool capable[MCPY_ENGINE_RENDER + 1] = {};
+    capable[MCPY_ENGINE_VEBOX]  = caps.engineVebox;
+    capable[MCPY_ENGINE_BLT]    = caps.engineBlt;
+    capable[MCPY_ENGINE_RENDER] = caps.engineRender;
+
+    MCPY_ENGINE selected = preferEngine;
+    uint32_t    minLoad  = GetEngineLoad(preferEngine);
+
+    // ties keep the preferred engine, then BLT over vebox since it does not compete with VP.
+    const MCPY_ENGINE candidates[] = {MCPY_ENGINE_BLT, MCPY_ENGINE_RENDER, MCPY_ENGINE_VEBOX};
+    for (auto engine : candidates)
+    {
+        if (minLoad == 0)
+        {
+            break;
+        }
+        if (engine == preferEngine || !capable[engine])
+        {
+            continue;
+        }
+        uint32_t load = GetEngineLoad(engine);
+        if (load < minLoad)
+        {
+            selected = engine;
+            minLoad  = load;
+        }
+    }
+
+    if (selected != preferEngine)
+    {
+        MCPY_NORMALMESSAGE("engine %d busy, copy moved to engine %d with %d pending submissions", preferEngine, selected, minLoad);
+    }
+    return selected;
+}
+
 uint32_t GetMinRequiredSurfaceSizeInBytes(uint32_t pitch, uint32_t height, MOS_FORMAT format)
 {
     uint32_t nBytes = 0;
@@ -361,6 +429,109 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
+    MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+    MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+    MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
+
+    MCPY_CHK_STATUS_RETURN(PrepareCopy(src, dst, preferMethod, mcpySrc, mcpyDst, mcpyEngine));
+
+    MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
+
+    return eStatus;
+}
+
+MOS_STATUS MediaCopyBaseState::SurfaceCopyBatch(MCPY_COPY_ITEM *copies, uint32_t count, MCPY_METHOD preferMethod)
+{
+    MCPY_CHK_NULL_RETURN(copies);
+
+    std::vector<PMOS_RESOURCE> bltSrc;
+    std::vector<PMOS_RESOURCE> bltDst;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        MCPY_CHK_NULL_RETURN(copies[i].src);
+        MCPY_CHK_NULL_RETURN(copies[i].dst);
+
+        MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+        MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+        MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
+
+        MCPY_CHK_STATUS_RETURN(PrepareCopy(copies[i].src, copies[i].dst, preferMethod, mcpySrc, mcpyDst, mcpyEngine));
+
+        // consecutive blt copies without decompression are coalesced into one submission,
+        // others keep the per copy dispatch.
+        bool needDecomp = ((mcpySrc.TileMode != MOS_TILE_LINEAR) && (mcpySrc.CompressionMode != MOS_MMC_DISABLED)) ||
+                          ((mcpyDst.TileMode != MOS_TILE_LINEAR) && (mcpyDst.CompressionMode == MOS_MMC_RC));
+        if (mcpyEngine == MCPY_ENGINE_BLT && !needDecomp)
+        {
+            bltSrc.push_back(copies[i].src);
+            bltDst.push_back(copies[i].dst);
+        }
+        else
+        {
+            // a later copy may depend on the pending blt copies, submit them first
+            MCPY_CHK_STATUS_RETURN(FlushBltCopyBatch(bltSrc, bltDst));
+            MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
+        }
+    }
+
+    MCPY_CHK_STATUS_RETURN(FlushBltCopyBatch(bltSrc, bltDst));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS MediaCopyBaseState::FlushBltCopyBatch(std::vector<PMOS_RESOURCE> &src, std::vector<PMOS_RESOURCE> &dst)
+{
+    if (src.empty())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    for (auto resource : src)
+    {
+        DumpCopySurface(resource, true);
+    }
+
+    MosUtilities::MosLockMutex(m_inUseGPUMutex);
+    MOS_STATUS eStatus = MediaBltCopyBatch(src.data(), dst.data(), (uint32_t)src.size());
+    if (eStatus == MOS_STATUS_SUCCESS)
+    {
+        m_engineGpuContext[MCPY_ENGINE_BLT] = m_osInterface->pfnGetGpuContext(m_osInterface);
+    }
+    MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
+
+    for (auto resource : dst)
+    {
+        ReportCopyEngine(MCPY_ENGINE_BLT);
+        DumpCopySurface(resource, false);
+    }
+
+    src.clear();
+    dst.clear();
+
+    return eStatus;
+}
+
+MOS_STATUS MediaCopyBaseState::MediaBltCopyBatch(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t count)
+{
+    MCPY_CHK_NULL_RETURN(src);
+    MCPY_CHK_NULL_RETURN(dst);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        MCPY_CHK_STATUS_RETURN(MediaBltCopy(src[i], dst[i]));
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS MediaCopyBaseState::PrepareCopy(
+    PMOS_RESOURCE      src,
+    PMOS_RESOURCE      dst,
+    MCPY_METHOD        preferMethod,
+    MCPY_STATE_PARAMS &mcpySrc,
+    MCPY_STATE_PARAMS &mcpyDst,
+    MCPY_ENGINE       &mcpyEngine)
+{
     MOS_SURFACE SrcResDetails, DstResDetails;
     MOS_ZeroMemory(&SrcResDetails, sizeof(MOS_SURFACE));
     MOS_ZeroMemory(&DstResDetails, sizeof(MOS_SURFACE));
@@ -369,9 +540,6 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
     DstResDetails.Format     = Format_Invalid;
     DstResDetails.OsResource = *dst;
 
-    MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
-    MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
-    MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
     MCPY_ENGINE_CAPS      mcpyEngineCaps = {1, 1, 1, 1};
 
     MCPY_CHK_STATUS_RETURN(m_osInterface->pfnGetResourceInfo(m_osInterface, src, &SrcResDetails));
@@ -424,55 +592,14 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
 
     MCPY_CHK_STATUS_RETURN(ValidateResource(SrcResDetails, DstResDetails, mcpyEngine));
 
-    MCPY_CHK_STATUS_RETURN(TaskDispatch(mcpySrc, mcpyDst, mcpyEngine));
-
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STATE_PARAMS mcpyDst, MCPY_ENGINE mcpyEngine)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
-
-#if (_DEBUG || _RELEASE_INTERNAL)
-    MOS_SURFACE sourceSurface = {};
-    MOS_SURFACE targetSurface = {};
-
-    char  dumpLocation_in[MAX_PATH];
-    char  dumpLocation_out[MAX_PATH];
-
-    MOS_ZeroMemory(dumpLocation_in, MAX_PATH);
-    MOS_ZeroMemory(dumpLocation_out, MAX_PATH);
-
-    targetSurface.Format = Format_Invalid;
-    targetSurface.OsResource = *mcpyDst.OsRes;
-
-#if !defined(LINUX) && !defined(ANDROID) && !EMUL
-    MOS_ZeroMemory(&targetSurface.OsResource.AllocationInfo, sizeof(SResidencyInfo));
-#endif
-
-    sourceSurface.Format = Format_Invalid;
-    sourceSurface.OsResource = *mcpySrc.OsRes;
-
-    m_osInterface->pfnGetResourceInfo(m_osInterface, &sourceSurface.OsResource, &sourceSurface);
-    m_osInterface->pfnGetResourceInfo(m_osInterface, &targetSurface.OsResource, &targetSurface);
-
-    // Set the dump location like "dumpLocation before MCPY=path_to_dump_folder" in user feature configure file
-    // Otherwise, the surface may not be dumped
-    if (m_surfaceDumper)
-    {
-        m_surfaceDumper->GetSurfaceDumpLocation(dumpLocation_in, mcpy_in);
-
-        if ((*dumpLocation_in == '\0') || (*dumpLocation_in == ' '))
-        {
-            MCPY_NORMALMESSAGE("Invalid dump location set, the surface will not be dumped");
-        }
-        else
-        {
-            m_surfaceDumper->DumpSurfaceToFile(m_osInterface, &sourceSurface, dumpLocation_in, m_surfaceDumper->m_frameNum, true, false, nullptr);
-        }
-    }
-#endif
+    DumpCopySurface(mcpySrc.OsRes, true);
 
     MosUtilities::MosLockMutex(m_inUseGPUMutex);
     switch(mcpyEngine)
@@ -509,8 +636,67 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
         default:
             break;
     }
+    if (eStatus == MOS_STATUS_SUCCESS && mcpyEngine <= MCPY_ENGINE_RENDER)
+    {
+        // remember the gpu context the engine copy submitted on, for load tracking.
+        m_engineGpuContext[mcpyEngine] = m_osInterface->pfnGetGpuContext(m_osInterface);
+    }
     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
 
+    ReportCopyEngine(mcpyEngine);
+    DumpCopySurface(mcpyDst.OsRes, false);
+
+    return eStatus;
+}
+
+void MediaCopyBaseState::DumpCopySurface(PMOS_RESOURCE resource, bool beforeCopy)
+{
+#if (_DEBUG || _RELEASE_INTERNAL)
+    if (m_surfaceDumper == nullptr || resource == nullptr)
+    {
+        return;
+    }
+
+    MOS_SURFACE surface = {};
+    char        dumpLocation[MAX_PATH];
+
+    MOS_ZeroMemory(dumpLocation, MAX_PATH);
+
+    surface.Format     = Format_Invalid;
+    surface.OsResource = *resource;
+
+#if !defined(LINUX) && !defined(ANDROID) && !EMUL
+    if (!beforeCopy)
+    {
+        MOS_ZeroMemory(&surface.OsResource.AllocationInfo, sizeof(SResidencyInfo));
+    }
+#endif
+
+    m_osInterface->pfnGetResourceInfo(m_osInterface, &surface.OsResource, &surface);
+
+    // Set the dump location like "dumpLocation before MCPY=path_to_dump_folder" or
+    // "dumpLocation after MCPY=path_to_dump_folder" in user feature configure file
+    // Otherwise, the surface may not be dumped
+    m_surfaceDumper->GetSurfaceDumpLocation(dumpLocation, beforeCopy ? mcpy_in : mcpy_out);
+
+    if ((*dumpLocation == '\0') || (*dumpLocation == ' '))
+    {
+        MCPY_NORMALMESSAGE("Invalid dump location set, the surface will not be dumped");
+    }
+    else
+    {
+        m_surfaceDumper->DumpSurfaceToFile(m_osInterface, &surface, dumpLocation, m_surfaceDumper->m_frameNum, true, false, nullptr);
+    }
+
+    if (!beforeCopy)
+    {
+        m_surfaceDumper->m_frameNum++;
+    }
+#endif
+}
+
+void MediaCopyBaseState::ReportCopyEngine(MCPY_ENGINE mcpyEngine)
+{
 #if (_DEBUG || _RELEASE_INTERNAL)
     if (m_bRegReport)
     {
@@ -522,27 +708,8 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
             copyEngine,
             MediaUserSetting::Group::Device);
     }
-
-    // Set the dump location like "dumpLocation after MCPY=path_to_dump_folder" in user feature configure file
-    // Otherwise, the surface may not be dumped
-    if (m_surfaceDumper)
-    {
-        m_surfaceDumper->GetSurfaceDumpLocation(dumpLocation_out, mcpy_out);
-
-        if ((*dumpLocation_out == '\0') || (*dumpLocation_out == ' '))
-        {
-            MCPY_NORMALMESSAGE("Invalid dump location set, the surface will not be dumped");
-        }
-        else
-        {
-            m_surfaceDumper->DumpSurfaceToFile(m_osInterface, &targetSurface, dumpLocation_out, m_surfaceDumper->m_frameNum, true, false, nullptr);
-        }
-        m_surfaceDumper->m_frameNum++;
-    }
 #endif
     MCPY_NORMALMESSAGE("Media Copy works on %s Engine", mcpyEngine ?(mcpyEngine == MCPY_ENGINE_BLT?"BLT":"Render"):"VeBox");
-
-    return eStatus;
 }
 
 //!
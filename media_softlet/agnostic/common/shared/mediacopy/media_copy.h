@@ -29,6 +29,7 @@
 #define __MEDIA_COPY_H__
 
 #include <stdint.h>
+#include <vector>
 #include "mos_defs.h"
 #include "mos_defs_specific.h"
 #include "mos_os_specific.h"
@@ -62,7 +63,7 @@ enum MCPY_CPMODE
 
 enum MCPY_METHOD
 {
-    MCPY_METHOD_DEFAULT = 0,  
+    MCPY_METHOD_DEFAULT = 0,  // least loaded capable engine, render preferred.
     MCPY_METHOD_POWERSAVING,  // use BCS engine
     MCPY_METHOD_PERFORMANCE,  // use EU to get the best perf.
     MCPY_METHOD_BALANCE,      // use vebox engine.
@@ -77,6 +78,12 @@ typedef struct _MCPY_STATE_PARAMS
     bool                  bAuxSuface;
 }MCPY_STATE_PARAMS;
 
+typedef struct _MCPY_COPY_ITEM
+{
+    PMOS_RESOURCE        src;                 // source resource
+    PMOS_RESOURCE        dst;                 // destination resource
+}MCPY_COPY_ITEM;
+
 class MediaCopyBaseState
 {
 public:
@@ -139,6 +146,23 @@ public:
     //!
     virtual MOS_STATUS SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst, MCPY_METHOD preferMethod = MCPY_METHOD_PERFORMANCE);
 
+    //!
+    //! \brief    batched surface copy func.
+    //! \details  copy a list of surfaces in order, consecutive copies landing on BLT engine are
+    //!           coalesced into one submission. Copies are submitted as the list is walked, so
+    //!           on failure the copies submitted before the failing one still execute, and the
+    //!           ones after it are not submitted.
+    //! \param    copies
+    //!           [in] Pointer to array of source/destination pairs
+    //! \param    count
+    //!           [in] number of copies
+    //! \param    preferMethod
+    //!           [in] Media copy Method applied to each copy
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS SurfaceCopyBatch(MCPY_COPY_ITEM *copies, uint32_t count, MCPY_METHOD preferMethod = MCPY_METHOD_PERFORMANCE);
+
     //!
     //! \brief    aux surface copy.
     //! \details  copy surface.
@@ -186,6 +210,65 @@ protected:
     //!
     virtual MOS_STATUS TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STATE_PARAMS mcpyDst, MCPY_ENGINE mcpyEngine);
 
+    //!
+    //! \brief    prepare copy task.
+    //! \details  query resource details, check capability, select engine and validate resources.
+    //! \param    src
+    //!           [in] Pointer to source surface
+    //! \param    dst
+    //!           [in] Pointer to destination surface
+    //! \param    preferMethod
+    //!           [in] Media copy Method
+    //! \param    mcpySrc
+    //!           [out] source paramters
+    //! \param    mcpyDst
+    //!           [out] destination paramters
+    //! \param    mcpyEngine
+    //!           [out] selected engine
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    MOS_STATUS PrepareCopy(
+        PMOS_RESOURCE      src,
+        PMOS_RESOURCE      dst,
+        MCPY_METHOD        preferMethod,
+        MCPY_STATE_PARAMS &mcpySrc,
+        MCPY_STATE_PARAMS &mcpyDst,
+        MCPY_ENGINE       &mcpyEngine);
+
+    //!
+    //! \brief    flush pending blt copies.
+    //! \details  submit the coalesced blt copies with the same dumps and reporting as TaskDispatch,
+    //!           and clear the lists.
+    //! \param    src
+    //!           [in, out] source surfaces of the pending copies
+    //! \param    dst
+    //!           [in, out] destination surfaces of the pending copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    MOS_STATUS FlushBltCopyBatch(std::vector<PMOS_RESOURCE> &src, std::vector<PMOS_RESOURCE> &dst);
+
+    //!
+    //! \brief    dump copy surface.
+    //! \details  dump the source surface before copy or the destination surface after copy, debug only.
+    //! \param    resource
+    //!           [in] Pointer to surface
+    //! \param    beforeCopy
+    //!           [in] true for the source surface before copy
+    //! \return   void
+    //!
+    void DumpCopySurface(PMOS_RESOURCE resource, bool beforeCopy);
+
+    //!
+    //! \brief    report copy engine.
+    //! \details  report the engine used by a copy to user setting and log.
+    //! \param    mcpyEngine
+    //!           [in] engine the copy was dispatched to
+    //! \return   void
+    //!
+    void ReportCopyEngine(MCPY_ENGINE mcpyEngine);
+
     //!
     //! \brief    vebox format support.
     //! \details  surface format support.
@@ -244,6 +327,30 @@ protected:
     //!
     virtual MOS_STATUS CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_ENGINE &mcpyEngine, MCPY_ENGINE_CAPS &caps);
 
+    //!
+    //! \brief    get copy engine load.
+    //! \details  number of media copy submissions on the engine not retired by GPU yet,
+    //!           derived from the GPU status tag of the engine's gpu context.
+    //! \param    mcpyEngine
+    //!           [in] copy engine
+    //! \return   uint32_t
+    //!           Return outstanding submissions, 0 if engine is idle or not used yet.
+    //!
+    virtual uint32_t GetEngineLoad(MCPY_ENGINE mcpyEngine);
+
+    //!
+    //! \brief    select least loaded copy enigne
+    //! \details  switch from the preferred engine to a capable engine with less outstanding work.
+    //!           preferred engine is kept on ties.
+    //! \param    preferEngine
+    //!           [in] engine selected by copy method
+    //! \param    caps
+    //!           [in] reference of featue supported engine
+    //! \return   MCPY_ENGINE
+    //!           Return selected engine.
+    //!
+    MCPY_ENGINE SelectLeastLoadedEngine(MCPY_ENGINE preferEngine, MCPY_ENGINE_CAPS &caps);
+
     //!
     //! \brief    use blt engie to do surface copy.
     //! \details  implementation media blt copy.
@@ -257,6 +364,21 @@ protected:
     virtual MOS_STATUS MediaBltCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
     {return MOS_STATUS_SUCCESS;}
 
+    //!
+    //! \brief    use blt engie to do a batch of surface copies.
+    //! \details  default implementation submits each copy separately, in order. On failure the
+    //!           copies submitted before the failing one still execute, the rest are not submitted.
+    //! \param    src
+    //!           [in] Pointer to array of source surfaces
+    //! \param    dst
+    //!           [in] Pointer to array of destination surfaces
+    //! \param    count
+    //!           [in] number of copies
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS MediaBltCopyBatch(PMOS_RESOURCE *src, PMOS_RESOURCE *dst, uint32_t count);
+
     //!
     //! \brief    use Render engie to do surface copy.
     //! \details  implementation media Render copy.
@@ -292,6 +414,7 @@ public:
 
 protected:
     PMOS_MUTEX           m_inUseGPUMutex        = nullptr; // Mutex for in-use GPU context
+    MOS_GPU_CONTEXT      m_engineGpuContext[MCPY_ENGINE_RENDER + 1] = {MOS_GPU_CONTEXT_MAX, MOS_GPU_CONTEXT_MAX, MOS_GPU_CONTEXT_MAX}; // last gpu context used per engine
 #if (_DEBUG || _RELEASE_INTERNAL)
     CommonSurfaceDumper *m_surfaceDumper        = nullptr;
     int                  m_MCPYForceMode        = 0;
@@ -45,6 +45,7 @@
 #define BLT_CHK_NULL_RETURN(_ptr)           MOS_CHK_NULL_RETURN(MOS_COMPONENT_MCPY, MOS_MCPY_SUBCOMP_BLT, _ptr)
 #define BLT_ASSERTMESSAGE(_message, ...)    MOS_ASSERTMESSAGE(MOS_COMPONENT_MCPY, MOS_MCPY_SUBCOMP_BLT, _message, ##__VA_ARGS__)
 #define BLT_BITS_PER_BYTE                   8
+#define BLT_MAX_BATCH_COPIES                64
 
 #define VEBOX_COPY                          0x700
 #define RENDER_COPY                         0x701
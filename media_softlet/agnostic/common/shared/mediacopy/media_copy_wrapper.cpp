@@ -94,3 +94,22 @@ MOS_STATUS MediaCopyWrapper::MediaCopy(
 
     return status;
 }
+
+MOS_STATUS MediaCopyWrapper::MediaCopyBatch(
+    MCPY_COPY_ITEM *copies,
+    uint32_t        count,
+    MCPY_METHOD     preferMethod)
+{
+    MCPY_CHK_NULL_RETURN(copies);
+    if (count == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+    if (nullptr == m_mediaCopyState)
+    {
+        CreateMediaCopyState();
+    }
+    MCPY_CHK_NULL_RETURN(m_mediaCopyState);
+
+    return m_mediaCopyState->SurfaceCopyBatch(copies, count, preferMethod);
+}
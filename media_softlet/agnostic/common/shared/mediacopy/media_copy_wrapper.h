@@ -95,6 +95,22 @@ public:
         PMOS_RESOURCE outputResource,
         MCPY_METHOD   preferMethod);
 
+    //!
+    //! \brief    Media copy batch
+    //! \details  Entry point to copy a list of media memory, copies on the same engine share one submission
+    //! \param    [in] copies
+    //!            Array of source/destination resource pairs
+    //! \param    [in] count
+    //!            Number of copies
+    //! \param    [in] preferMethod
+    //!            The preferred copy mode
+    //! \return   MOS_STATUS_SUCCESS if succeeded, else error code.
+    //!
+    MOS_STATUS MediaCopyBatch(
+        MCPY_COPY_ITEM *copies,
+        uint32_t        count,
+        MCPY_METHOD     preferMethod);
+
 private:
     PMOS_INTERFACE     m_osInterface     = nullptr;
     MediaCopyBaseState *m_mediaCopyState = nullptr;
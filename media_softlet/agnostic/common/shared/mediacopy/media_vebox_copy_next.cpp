@@ -200,7 +200,24 @@ MOS_STATUS VeboxCopyStateNext::CopyMainSurface(PMOS_RESOURCE src, PMOS_RESOURCE
 
     auto& flushDwParams = m_miItf->MHW_GETPAR_F(MI_FLUSH_DW)();
     flushDwParams = {};
+    if (!m_osInterface->bEnableKmdMediaFrameTracking)
+    {
+        // Write back GPU status tag so media copy can track outstanding vebox work
+        PMOS_RESOURCE gpuStatusBuffer = nullptr;
+        VEBOX_COPY_CHK_STATUS_RETURN(m_osInterface->pfnGetGpuStatusBufferResource(m_osInterface, gpuStatusBuffer));
+        VEBOX_COPY_CHK_NULL_RETURN(gpuStatusBuffer);
+        VEBOX_COPY_CHK_STATUS_RETURN(m_osInterface->pfnRegisterResource(m_osInterface, gpuStatusBuffer, true, true));
+
+        flushDwParams.pOsResource      = gpuStatusBuffer;
+        flushDwParams.dwResourceOffset = m_osInterface->pfnGetGpuStatusTagOffset(m_osInterface, VeboxGpuContext);
+        flushDwParams.dwDataDW1        = m_osInterface->pfnGetGpuStatusTag(m_osInterface, VeboxGpuContext);
+    }
     VEBOX_COPY_CHK_STATUS_RETURN(m_miItf->MHW_ADDCMD_F(MI_FLUSH_DW)(&cmdBuffer));
+    if (!m_osInterface->bEnableKmdMediaFrameTracking)
+    {
+        // Increase buffer tag for next usage
+        m_osInterface->pfnIncrementGpuStatusTag(m_osInterface, VeboxGpuContext);
+    }
 
     if (!m_osInterface->bEnableKmdMediaFrameTracking && veboxHeap)
     {
@@ -31,6 +31,8 @@
 using namespace vp;
 extern const Kdll_RuleEntry g_KdllRuleTable_Next[];
 const std::string VpRenderKernel::s_kernelNameNonAdvKernels = "vpFcKernels";
+std::map<const void *, VpRenderKernel::SharedKernelBin> VpRenderKernel::s_sharedKernelBins;
+std::mutex VpRenderKernel::s_sharedKernelBinMutex;
 
 VpPlatformInterface::VpPlatformInterface(PMOS_INTERFACE pOsInterface, bool clearViewMode)
 {
@@ -60,34 +62,25 @@ MOS_STATUS VpRenderKernel::InitVPKernel(
     void *pKernelBin  = nullptr;
     void *pFcPatchBin = nullptr;
 
-    pKernelBin = MOS_AllocMemory(m_kernelBinSize);
+    // Held across KDLL state allocation, which finalizes the shared binaries on first use
+    std::lock_guard<std::mutex> lock(s_sharedKernelBinMutex);
+
+    pKernelBin = AcquireSharedKernelBin(m_kernelBin, m_kernelBinSize);
     if (!pKernelBin)
     {
         VP_RENDER_ASSERTMESSAGE("local creat surface faile, retun no space");
-        MOS_SafeFreeMemory(pKernelBin);
         return MOS_STATUS_NO_SPACE;
     }
 
-    MOS_SecureMemcpy(pKernelBin,
-        m_kernelBinSize,
-        m_kernelBin,
-        m_kernelBinSize);
-
     if ((m_fcPatchBin != nullptr) && (m_fcPatchBinSize != 0))
     {
-        pFcPatchBin = MOS_AllocMemory(m_fcPatchBinSize);
+        pFcPatchBin = AcquireSharedKernelBin(m_fcPatchBin, m_fcPatchBinSize);
         if (!pFcPatchBin)
         {
             VP_RENDER_ASSERTMESSAGE("local creat surface faile, retun no space");
-            MOS_SafeFreeMemory(pKernelBin);
-            MOS_SafeFreeMemory(pFcPatchBin);
+            ReleaseSharedKernelBin(pKernelBin);
             return MOS_STATUS_NO_SPACE;
         }
-
-        MOS_SecureMemcpy(pFcPatchBin,
-            m_fcPatchBinSize,
-            m_fcPatchBin,
-            m_fcPatchBinSize);
     }
 
     // Allocate KDLL state (Kernel Dynamic Linking)
@@ -101,8 +94,8 @@ MOS_STATUS VpRenderKernel::InitVPKernel(
     if (!m_kernelDllState)
     {
         VP_RENDER_ASSERTMESSAGE("Failed to allocate KDLL state.");
-        MOS_SafeFreeMemory(pKernelBin);
-        MOS_SafeFreeMemory(pFcPatchBin);
+        ReleaseSharedKernelBin(pKernelBin);
+        ReleaseSharedKernelBin(pFcPatchBin);
     }
     else
     {
@@ -150,12 +143,68 @@ MOS_STATUS VpRenderKernel::Destroy()
 
     if (m_kernelDllState)
     {
+        std::lock_guard<std::mutex> lock(s_sharedKernelBinMutex);
+
+        // Component binaries are shared, not owned by KDLL state
+        ReleaseSharedKernelBin(m_kernelDllState->ComponentKernelCache.pCache);
+        ReleaseSharedKernelBin(m_kernelDllState->CmFcPatchCache.pCache);
+        m_kernelDllState->ComponentKernelCache.pCache = nullptr;
+        m_kernelDllState->CmFcPatchCache.pCache       = nullptr;
+
         KernelDll_ReleaseStates(m_kernelDllState);
     }
 
     return MOS_STATUS_SUCCESS;
 }
 
+void *VpRenderKernel::AcquireSharedKernelBin(const void *kernelBin, uint32_t kernelBinSize)
+{
+    VP_FUNC_CALL();
+
+    auto it = s_sharedKernelBins.find(kernelBin);
+    if (it != s_sharedKernelBins.end())
+    {
+        it->second.refCount++;
+        return it->second.bin;
+    }
+
+    void *bin = MOS_AllocMemory(kernelBinSize);
+    if (!bin)
+    {
+        return nullptr;
+    }
+    MOS_SecureMemcpy(bin, kernelBinSize, kernelBin, kernelBinSize);
+
+    SharedKernelBin &shared = s_sharedKernelBins[kernelBin];
+    shared.bin      = bin;
+    shared.refCount = 1;
+
+    return bin;
+}
+
+void VpRenderKernel::ReleaseSharedKernelBin(void *sharedBin)
+{
+    VP_FUNC_CALL();
+
+    if (sharedBin == nullptr)
+    {
+        return;
+    }
+
+    for (auto it = s_sharedKernelBins.begin(); it != s_sharedKernelBins.end(); ++it)
+    {
+        if (it->second.bin == sharedBin)
+        {
+            if (--it->second.refCount == 0)
+            {
+                MOS_FreeMemory(sharedBin);
+                s_sharedKernelBins.erase(it);
+            }
+            return;
+        }
+    }
+}
+
 MOS_STATUS VpPlatformInterface::InitPolicyRules(VP_POLICY_RULES &rules)
 {
     VP_FUNC_CALL();
@@ -32,6 +32,8 @@
 #include "vp_render_common.h"
 #include "vp_kernel_config.h"
 #include "media_copy.h"
+#include <map>
+#include <mutex>
 
 namespace vp
 {
@@ -160,6 +162,38 @@ protected:
 public:
     const static std::string          s_kernelNameNonAdvKernels;
 
+protected:
+    //!
+    //! \brief    Get the process-wide copy of a kernel binary
+    //! \details  KDLL sorts the link data of the component binary in place once and only
+    //!           reads it afterwards, so all VP instances share one copy per source binary.
+    //!           Caller must hold s_sharedKernelBinMutex.
+    //! \param    [in] kernelBin
+    //!           Source kernel binary
+    //! \param    [in] kernelBinSize
+    //!           Source kernel binary size
+    //! \return   void *
+    //!           Shared copy, nullptr if failed to allocate
+    //!
+    static void *AcquireSharedKernelBin(const void *kernelBin, uint32_t kernelBinSize);
+
+    //!
+    //! \brief    Release the process-wide copy of a kernel binary
+    //! \details  Copy is freed with its last user. Caller must hold s_sharedKernelBinMutex.
+    //! \param    [in] sharedBin
+    //!           Shared copy returned by AcquireSharedKernelBin, may be nullptr
+    //! \return   void
+    //!
+    static void ReleaseSharedKernelBin(void *sharedBin);
+
+    struct SharedKernelBin
+    {
+        void     *bin      = nullptr;
+        uint32_t refCount  = 0;
+    };
+    static std::map<const void *, SharedKernelBin> s_sharedKernelBins;
+    static std::mutex                              s_sharedKernelBinMutex;
+
 MEDIA_CLASS_DEFINE_END(vp__VpRenderKernel)
 };
 
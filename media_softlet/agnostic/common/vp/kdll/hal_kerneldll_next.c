@@ -3662,9 +3662,12 @@ Kdll_State *KernelDll_AllocateStates(
         }
     }
 
-    // Copy sort data
+    // Copy sort data, unless already sorted (binary shared with other kdll states, which read it)
     pLinkData = pCacheEntry[0].pLink;
-    MOS_SecureMemcpy(pLinkData, iSize * sizeof(Kdll_LinkData), (void *)pLinkSort, iSize * sizeof(Kdll_LinkData));
+    if (memcmp(pLinkData, pLinkSort, iSize * sizeof(Kdll_LinkData)) != 0)
+    {
+        MOS_SecureMemcpy(pLinkData, iSize * sizeof(Kdll_LinkData), (void *)pLinkSort, iSize * sizeof(Kdll_LinkData));
+    }
 
     // Release sort buffers
     MOS_FreeMemory(pLinkOffset);
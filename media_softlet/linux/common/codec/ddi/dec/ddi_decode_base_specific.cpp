@@ -115,6 +115,18 @@ VAStatus DdiDecodeBase::ParseProcessingBuffer(
             DDI_CODEC_CHK_NULL(m_procBuf, "nullptr m_procBuf", VA_STATUS_ERROR_ALLOCATION_FAILED);
             MOS_SecureMemcpy(m_procBuf, sizeof(VAProcPipelineParameterBuffer), procBuf, sizeof(VAProcPipelineParameterBuffer));
         }
+        else
+        {
+            // Refresh the per frame post processing parameters, keep the decode output as vp input
+            VASurfaceID decodeOutput = m_procBuf->surface;
+            MOS_SecureMemcpy(m_procBuf, sizeof(VAProcPipelineParameterBuffer), procBuf, sizeof(VAProcPipelineParameterBuffer));
+            m_procBuf->surface = decodeOutput;
+        }
+        CopyProcessingBufferData(procBuf);
+
+        // Filters and HDR tone mapping are beyond SFC, chain them to vp on the decode output
+        m_vpFusionRequired = (procBuf->num_filters > 0 || procBuf->output_hdr_metadata != nullptr);
+
         auto decProcessingParams =
             (DecodeProcessingParams *)m_decodeCtx->DecodeParams.m_procParams;
 
@@ -239,6 +251,48 @@ VAStatus DdiDecodeBase::ParseProcessingBuffer(
 #endif
 }
 
+#ifdef _DECODE_PROCESSING_SUPPORTED
+void DdiDecodeBase::CopyProcessingBufferData(
+    VAProcPipelineParameterBuffer *procBuf)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    // m_procBuf is consumed at EndPicture, after the app may have destroyed the processing
+    // buffer, so the data it points to is copied into storage owned by the decoder
+    auto copyArray = [](auto *&dst, auto &storage, const auto *src, uint32_t count) {
+        storage.assign(src, src ? src + count : src);
+        dst = storage.empty() ? nullptr : storage.data();
+    };
+    auto copyStruct = [](auto *&dst, auto &storage, const auto *src) {
+        if (src != nullptr)
+        {
+            storage = *src;
+            dst     = &storage;
+        }
+        else
+        {
+            dst = nullptr;
+        }
+    };
+
+    copyStruct(m_procBuf->surface_region, m_procSurfaceRegion, procBuf->surface_region);
+    copyStruct(m_procBuf->output_region, m_procOutputRegion, procBuf->output_region);
+    copyStruct(m_procBuf->blend_state, m_procBlendState, procBuf->blend_state);
+    copyArray(m_procBuf->filters, m_procFilters, procBuf->filters, procBuf->num_filters);
+    copyArray(m_procBuf->forward_references, m_procFwdRefs, procBuf->forward_references, procBuf->num_forward_references);
+    copyArray(m_procBuf->backward_references, m_procBwdRefs, procBuf->backward_references, procBuf->num_backward_references);
+    // additional_outputs[0] is the decode processing output, read regardless of num_additional_outputs
+    copyArray(m_procBuf->additional_outputs, m_procAdditionalOutputs, procBuf->additional_outputs, MAX(procBuf->num_additional_outputs, 1));
+
+    copyStruct(m_procBuf->output_hdr_metadata, m_procHdrMetadata, procBuf->output_hdr_metadata);
+    if (m_procBuf->output_hdr_metadata != nullptr)
+    {
+        const uint8_t *metadata = (const uint8_t *)procBuf->output_hdr_metadata->metadata;
+        copyArray(m_procHdrMetadata.metadata, m_procHdrMetadataPayload, metadata, m_procHdrMetadata.metadata_size);
+    }
+}
+#endif
+
 VAStatus DdiDecodeBase::BeginPicture(
     VADriverContextP ctx,
     VAContextID      context,
@@ -257,6 +311,8 @@ VAStatus DdiDecodeBase::BeginPicture(
     {
         m_procBuf->surface = renderTarget;
     }
+    // Chained only if this frame sends a processing buffer with filters or HDR metadata
+    m_vpFusionRequired = false;
 #endif
 
     DDI_MEDIA_SURFACE *curRT = nullptr;
@@ -624,23 +680,37 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         bsBufObj->pMediaCtx = m_decodeCtx->pMediaCtx;
         bsBufBaseAddr       = bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex];
 
+        // When the application streams a frame as several slice data buffers, only the
+        // first one is known here. Size the bitstream buffer for the recent peak frame size,
+        // so later slices land in the bo directly instead of spilling into ext buffers
+        // that EndPicture has to combine with an extra copy. The peak decays by 1/8 per
+        // frame, so a single large frame or a resolution drop doesn't size the bos for good.
+        bufMgr->dwMaxFrameSliceDataSize = MOS_MAX(bufMgr->dwFrameSliceDataSize,
+            bufMgr->dwMaxFrameSliceDataSize - (bufMgr->dwMaxFrameSliceDataSize >> 3));
+        bufMgr->dwFrameSliceDataSize    = 0;
+        uint32_t requiredSize = MOS_MAX((uint32_t)buf->iSize, bufMgr->dwMaxFrameSliceDataSize);
+
         if (bsBufBaseAddr == nullptr)
         {
             createBsBuffer = true;
-            if (buf->iSize > bsBufObj->iSize)
+            if (requiredSize > (uint32_t)bsBufObj->iSize)
             {
-                bsBufObj->iSize = buf->iSize;
+                bsBufObj->iSize = requiredSize;
             }
         }
-        else if (buf->iSize > bsBufObj->iSize)
+        else if (requiredSize > (uint32_t)bsBufObj->iSize ||
+                 (uint32_t)bsBufObj->iSize > MOS_MAX(requiredSize * 2, bufMgr->dwMaxBsSize))
         {
+            // Regrow for a larger frame, or shrink a bo left oversized by an earlier peak
+            requiredSize = MOS_MAX(requiredSize, bufMgr->dwMaxBsSize);
+
            // free bo
             MediaLibvaUtilNext::UnlockBuffer(bsBufObj);
             MediaLibvaUtilNext::FreeBuffer(bsBufObj);
             bsBufBaseAddr = nullptr;
 
             createBsBuffer  = true;
-            bsBufObj->iSize = buf->iSize;
+            bsBufObj->iSize = requiredSize;
         }
 
         if (createBsBuffer)
@@ -668,6 +738,9 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
     bufMgr->pSliceData[index].uiLength = buf->iSize;
     bufMgr->pSliceData[index].uiOffset = buf->uiOffset;
 
+    // buf->uiOffset is the offset in the frame even when the slice spills to an ext buffer
+    bufMgr->dwFrameSliceDataSize = MOS_MAX(bufMgr->dwFrameSliceDataSize, buf->uiOffset + buf->iSize);
+
     if (bufMgr->bIsSliceOverSize == true)
     {
         buf->pData                              = sliceBuf;
@@ -792,7 +865,7 @@ VAStatus DdiDecodeBase::ExtraDownScaling(
 
     if (m_decodeCtx->DecodeParams.m_procParams != nullptr &&
        m_procBuf &&
-       !isDecodeDownScalingSupported)
+       (!isDecodeDownScalingSupported || m_vpFusionRequired))
     {
         // check vp context
         VAContextID vpCtxID = VA_INVALID_ID;
@@ -976,7 +1049,21 @@ VAStatus DdiDecodeBase::EndPicture(
         DDI_CHK_RET(InitDummyReference(*decoder), "InitDummyReference failed!");
     }
 
+#ifdef _DECODE_PROCESSING_SUPPORTED
+    // When vp does the post processing, skip the SFC pass in decode to avoid writing the output twice
+    void *procParams = m_decodeCtx->DecodeParams.m_procParams;
+    if (m_vpFusionRequired)
+    {
+        m_decodeCtx->DecodeParams.m_procParams = nullptr;
+    }
+#endif
+
     MOS_STATUS status = m_decodeCtx->pCodecHal->Execute((void *)(&m_decodeCtx->DecodeParams));
+
+#ifdef _DECODE_PROCESSING_SUPPORTED
+    m_decodeCtx->DecodeParams.m_procParams = procParams;
+#endif
+
     if (status != MOS_STATUS_SUCCESS)
     {
         DDI_CODEC_ASSERTMESSAGE("DDI:DdiDecode_DecodeInCodecHal return failure.");
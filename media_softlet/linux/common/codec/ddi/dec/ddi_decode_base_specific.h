@@ -28,6 +28,7 @@
 #define _DDI_DECODE_BASE_SPECIFIC_H_
 
 #include <stdint.h>
+#include <vector>
 #include <va/va.h>
 #include "ddi_codec_base_specific.h"
 #include "decode_pipeline_adapter.h"
@@ -379,6 +380,19 @@ protected:
         DDI_MEDIA_CONTEXT *mediaCtx,
         void              *bufAddr);
 
+#ifdef _DECODE_PROCESSING_SUPPORTED
+    //!
+    //! \brief    Copy the data referenced by the processing buffer
+    //! \details  Points m_procBuf at decoder owned copies of the regions, blend state,
+    //!           filter and surface lists and HDR metadata, which are used at EndPicture
+    //!
+    //! \param    [in] procBuf
+    //!           the processing buffer passed by the app
+    //!
+    void CopyProcessingBufferData(
+        VAProcPipelineParameterBuffer *procBuf);
+#endif
+
     //!
     //! \brief    Create the back-end CodecHal of DdiDecodeBase
     //! \details  Create the back-end CodecHal of DdiDecodeBase base on
@@ -422,7 +436,9 @@ protected:
         uint16_t wMode);
 
     //! \brief    Use EU path to do the scaling
-    //! \details  When VD+SFC are not supported, it will call into VPhal to do scaling
+    //! \details  When VD+SFC are not supported, or the post processing needs
+    //!           vebox/render filters, it will call into VPhal with the decode
+    //!           output as input, the submission is synced on GPU side
     //!
     //! \param    [in] ctx
     //!           VADriverContextP * type
@@ -473,6 +489,16 @@ protected:
 #ifdef _DECODE_PROCESSING_SUPPORTED
     bool                           m_requireInputRegion = false;
     VAProcPipelineParameterBuffer *m_procBuf = nullptr; //!< Process parameters for vp sfc input
+    bool                           m_vpFusionRequired = false; //!< Post processing is chained to vp instead of SFC
+    VARectangle                    m_procSurfaceRegion = {};    //!< Copy of m_procBuf->surface_region
+    VARectangle                    m_procOutputRegion = {};     //!< Copy of m_procBuf->output_region
+    VABlendState                   m_procBlendState = {};       //!< Copy of m_procBuf->blend_state
+    VAHdrMetaData                  m_procHdrMetadata = {};      //!< Copy of m_procBuf->output_hdr_metadata
+    std::vector<uint8_t>           m_procHdrMetadataPayload;    //!< Copy of the HDR metadata payload
+    std::vector<VABufferID>        m_procFilters;               //!< Copy of m_procBuf->filters
+    std::vector<VASurfaceID>       m_procFwdRefs;               //!< Copy of m_procBuf->forward_references
+    std::vector<VASurfaceID>       m_procBwdRefs;               //!< Copy of m_procBuf->backward_references
+    std::vector<VASurfaceID>       m_procAdditionalOutputs;     //!< Copy of m_procBuf->additional_outputs
 #endif
 MEDIA_CLASS_DEFINE_END(decode__DdiDecodeBase)
 };
@@ -24,6 +24,7 @@
 //! \brief    Implements base class for DDI media encode and encode parameters parser
 //!
 
+#include <chrono>
 #include "media_libva_util.h"
 #include "ddi_encode_base_specific.h"
 #include "media_libva_util_next.h"
@@ -76,8 +77,36 @@ VAStatus DdiEncodeBase::EndPicture(
     PDDI_MEDIA_CONTEXT mediaCtx = GetMediaContext(ctx);
     DDI_CODEC_CHK_NULL(mediaCtx, "Null mediaCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
 
-    VAStatus status = EncodeInCodecHal(m_encodeCtx->dwNumSlices);
+    DDI_CODEC_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    VAStatus status = VA_STATUS_SUCCESS;
+    if (m_asyncStatusReport)
+    {
+        {
+            // Codechal Execute and GetStatusReport share the status report state,
+            // only serialize them so the status list stays available meanwhile
+            std::lock_guard<std::mutex> codecHalLock(m_codecHalMutex);
+            status = EncodeInCodecHal(m_encodeCtx->dwNumSlices);
+        }
+
+        // Frames queued but not submitted won't get status report
+        std::lock_guard<std::mutex> lock(m_statusMutex);
+        if (VA_STATUS_SUCCESS == status)
+        {
+            m_statusSubmitted = m_statusQueued;
+            m_statusCond.notify_all();
+        }
+        else
+        {
+            m_statusQueued = m_statusSubmitted;
+        }
+    }
+    else
+    {
+        status = EncodeInCodecHal(m_encodeCtx->dwNumSlices);
+    }
     ClearPicParams();
+
     if (VA_STATUS_SUCCESS != status)
     {
         DDI_CODEC_ASSERTMESSAGE("DDI:DdiEncode_EncodeInCodecHal return failure.");
@@ -100,6 +129,8 @@ VAStatus DdiEncodeBase::AddToStatusReportQueue(void *codedBuf)
     DDI_CODEC_CHK_NULL(m_encodeCtx->pCpDdiInterfaceNext, "Null m_encodeCtx->pCpDdiInterfaceNext", VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CODEC_CHK_NULL(codedBuf, "Null codedBuf", VA_STATUS_ERROR_INVALID_BUFFER);
 
+    std::lock_guard<std::mutex> lock(m_statusMutex);
+
     int32_t idx                                       = m_encodeCtx->statusReportBuf.ulHeadPosition;
     m_encodeCtx->statusReportBuf.infos[idx].pCodedBuf = codedBuf;
     m_encodeCtx->statusReportBuf.infos[idx].uiSize    = 0;
@@ -112,6 +143,7 @@ VAStatus DdiEncodeBase::AddToStatusReportQueue(void *codedBuf)
     }
 #endif 
     m_encodeCtx->statusReportBuf.ulHeadPosition = (m_encodeCtx->statusReportBuf.ulHeadPosition + 1) % DDI_ENCODE_MAX_STATUS_REPORT_BUFFER;
+    m_statusQueued++;
 
     return VA_STATUS_SUCCESS;
 
@@ -169,6 +201,11 @@ VAStatus DdiEncodeBase::StatusReport(
 
     m_encodeCtx->BufMgr.pCodedBufferSegment->status    = 0;
 
+    if (m_asyncStatusReport)
+    {
+        return AsyncStatusReport(mediaBuf, buf);
+    }
+
     //when this function is called, there must be a frame is ready, will wait until get the right information.
     uint32_t size         = 0;
     int32_t  index        = 0;
@@ -211,23 +248,7 @@ VAStatus DdiEncodeBase::StatusReport(
 
         if (CODECHAL_STATUS_SUCCESSFUL == encodeStatusReportData[0].codecStatus)
         {
-            // Only AverageQP is reported at this time. Populate other bits with relevant informaiton later;
-            status = (encodeStatusReportData[0].averageQP & VA_CODED_BUF_STATUS_PICTURE_AVE_QP_MASK);
-            if(m_encodeCtx->wModeType == CODECHAL_ENCODE_MODE_AVC)
-            {
-                CodecEncodeAvcFeiPicParams *feiPicParams = (CodecEncodeAvcFeiPicParams*) m_encodeCtx->pFeiPicParams;
-                if ((feiPicParams != NULL) && (feiPicParams->dwMaxFrameSize != 0))
-                {
-                    // The reported the pass number should be multi-pass PAK caused by the MaxFrameSize.
-                    // if the suggestedQpYDelta is 0, it means that MaxFrameSize doesn't trigger multi-pass PAK.
-                    // The MaxMbSize triggers multi-pass PAK, the cases should be ignored when reporting the PAK pass.
-                    if ((encodeStatusReportData[0].suggestedQPYDelta == 0) && (encodeStatusReportData[0].numberPasses != 1))
-                    {
-                        encodeStatusReportData[0].numberPasses = 1;
-                    }
-                }
-            }
-            status = status | ((encodeStatusReportData[0].numberPasses) & 0xf)<<24;
+            status = GetCodedBufferStatus(encodeStatusReportData);
             // fill hdcp related buffer
             DDI_CODEC_CHK_RET(m_encodeCtx->pCpDdiInterfaceNext->StatusReportForHdcp2Buffer(&m_encodeCtx->BufMgr, encodeStatusReportData), "fail to get hdcp2 status report!");
             if (UpdateStatusReportBuffer(encodeStatusReportData[0].bitstreamSize, status) != VA_STATUS_SUCCESS)
@@ -296,6 +317,278 @@ VAStatus DdiEncodeBase::StatusReport(
     return VA_STATUS_SUCCESS;
 }
 
+VAStatus DdiEncodeBase::QuerySliceProgress(
+    DDI_MEDIA_BUFFER *mediaBuf,
+    uint32_t         *sliceSizes,
+    uint32_t         maxSlices,
+    uint32_t         *numSlices,
+    uint32_t         *passIndex)
+{
+    DDI_CODEC_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CODEC_CHK_NULL(m_encodeCtx->pCodecHal, "Null m_encodeCtx->pCodecHal", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CODEC_CHK_NULL(mediaBuf, "Null mediaBuf", VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CODEC_CHK_NULL(sliceSizes, "Null sliceSizes", VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CODEC_CHK_NULL(numSlices, "Null numSlices", VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CODEC_CHK_NULL(passIndex, "Null passIndex", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    std::lock_guard<std::mutex> lock(m_statusMutex);
+
+    *numSlices = 0;
+    *passIndex = 0;
+
+    // Only the oldest pending picture is being written by PAK
+    uint32_t oldest = m_encodeCtx->statusReportBuf.ulUpdatePosition;
+    if (oldest == m_encodeCtx->statusReportBuf.ulHeadPosition ||
+        m_encodeCtx->statusReportBuf.infos[oldest].pCodedBuf != (void *)mediaBuf->bo)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    uint32_t   completed = 0;
+    uint32_t   pass      = 0;
+    MOS_STATUS mosStatus = m_encodeCtx->pCodecHal->GetSliceProgress(sliceSizes, maxSlices, completed, pass);
+    if (MOS_STATUS_UNIMPLEMENTED == mosStatus)
+    {
+        return VA_STATUS_ERROR_UNIMPLEMENTED;
+    }
+    else if (MOS_STATUS_SUCCESS != mosStatus)
+    {
+        return VA_STATUS_ERROR_OPERATION_FAILED;
+    }
+
+    *numSlices = completed;
+    *passIndex = pass;
+    return VA_STATUS_SUCCESS;
+}
+
+uint32_t DdiEncodeBase::GetCodedBufferStatus(EncodeStatusReportData *encodeStatusReportData)
+{
+    // Only AverageQP is reported at this time. Populate other bits with relevant informaiton later;
+    uint32_t status = (encodeStatusReportData[0].averageQP & VA_CODED_BUF_STATUS_PICTURE_AVE_QP_MASK);
+    if(m_encodeCtx->wModeType == CODECHAL_ENCODE_MODE_AVC)
+    {
+        CodecEncodeAvcFeiPicParams *feiPicParams = (CodecEncodeAvcFeiPicParams*) m_encodeCtx->pFeiPicParams;
+        if ((feiPicParams != NULL) && (feiPicParams->dwMaxFrameSize != 0))
+        {
+            // The reported the pass number should be multi-pass PAK caused by the MaxFrameSize.
+            // if the suggestedQpYDelta is 0, it means that MaxFrameSize doesn't trigger multi-pass PAK.
+            // The MaxMbSize triggers multi-pass PAK, the cases should be ignored when reporting the PAK pass.
+            if ((encodeStatusReportData[0].suggestedQPYDelta == 0) && (encodeStatusReportData[0].numberPasses != 1))
+            {
+                encodeStatusReportData[0].numberPasses = 1;
+            }
+        }
+    }
+    status = status | ((encodeStatusReportData[0].numberPasses) & 0xf)<<24;
+    return status;
+}
+
+VAStatus DdiEncodeBase::AsyncStatusReport(
+    DDI_MEDIA_BUFFER    *mediaBuf,
+    void                **buf)
+{
+    uint32_t size   = 0;
+    int32_t  index  = DDI_CODEC_INVALID_BUFFER_INDEX;
+    uint32_t status = 0;
+
+    // No limit here, like the synchronous path waiting on the bitstream. The thread
+    // applies the 1s HW timeout once the bitstream is ready and reports it as error.
+    std::unique_lock<std::mutex> lock(m_statusMutex);
+    m_statusCond.wait(lock, [&]() {
+        return m_statusThreadExit ||
+               (GetSizeFromStatusReportBuffer(mediaBuf, &size, &status, &index) != VA_STATUS_SUCCESS) ||
+               (size != 0) || (status & VA_CODED_BUF_STATUS_BAD_BITSTREAM);
+    });
+    bool collected = (size != 0) || (status & VA_CODED_BUF_STATUS_BAD_BITSTREAM);
+
+    if (index < 0)
+    {
+        return VA_STATUS_ERROR_OPERATION_FAILED;
+    }
+
+    m_encodeCtx->BufMgr.pCodedBufferSegment->buf = MediaLibvaUtilNext::LockBuffer(mediaBuf, MOS_LOCKFLAG_READONLY);
+    if (!collected)
+    {
+        DDI_CODEC_ASSERTMESSAGE("Something unexpected happened in HW, return error to application");
+        m_encodeCtx->BufMgr.pCodedBufferSegment->size   = 0;
+        m_encodeCtx->BufMgr.pCodedBufferSegment->status |= VA_CODED_BUF_STATUS_BAD_BITSTREAM;
+        return VA_STATUS_ERROR_ENCODING_ERROR;
+    }
+
+    m_encodeCtx->BufMgr.pCodedBufferSegment->size   = size;
+    m_encodeCtx->BufMgr.pCodedBufferSegment->status = status;
+    if (status & VA_CODED_BUF_STATUS_BAD_BITSTREAM)
+    {
+        return VA_STATUS_ERROR_ENCODING_ERROR;
+    }
+
+    // The buffer manager belongs to the application thread, fill it from the
+    // status the thread saved for this coded buffer
+    EncodeStatusReportData *encodeStatusReportData = &m_collectedStatus[index];
+    DDI_CODEC_CHK_RET(m_encodeCtx->pCpDdiInterfaceNext->StatusReportForHdcp2Buffer(&m_encodeCtx->BufMgr, encodeStatusReportData), "fail to get hdcp2 status report!");
+    if (ReportExtraStatus(encodeStatusReportData, m_encodeCtx->BufMgr.pCodedBufferSegment) != VA_STATUS_SUCCESS)
+    {
+        return VA_STATUS_ERROR_OPERATION_FAILED;
+    }
+
+    *buf = m_encodeCtx->BufMgr.pCodedBufferSegment;
+    return VA_STATUS_SUCCESS;
+}
+
+void DdiEncodeBase::StatusReportThreadProc()
+{
+    // Wait the bitstream in slices so that stop request is handled in time
+    const int64_t                   boWaitTimeoutNs = 10000000;
+    // Status may land a bit later than the bitstream, e.g. Enc done but Pak not
+    const std::chrono::microseconds incompleteInterval(100);
+    const std::chrono::seconds      incompleteTimeout(1);
+
+    bool                                  incomplete      = false;
+    std::chrono::steady_clock::time_point incompleteStart;
+
+    std::unique_lock<std::mutex> lock(m_statusMutex);
+    while (!m_statusThreadExit)
+    {
+        if (m_statusCollected == m_statusSubmitted)
+        {
+            m_statusCond.wait(lock);
+            continue;
+        }
+
+        // Frames finish in submission order, wait for the oldest one without holding the lock
+        uint32_t     updatePosition = m_encodeCtx->statusReportBuf.ulUpdatePosition;
+        MOS_LINUX_BO *bo            = (MOS_LINUX_BO *)m_encodeCtx->statusReportBuf.infos[updatePosition].pCodedBuf;
+        if (bo != nullptr && !incomplete)
+        {
+            mos_bo_reference(bo);
+            lock.unlock();
+            int ret = mos_bo_wait(bo, boWaitTimeoutNs);
+            mos_bo_unreference(bo);
+            lock.lock();
+            if (ret != 0)
+            {
+                continue;
+            }
+        }
+
+        EncodeStatusReportData *encodeStatusReportData = (EncodeStatusReportData *)m_encodeCtx->pEncodeStatusReport;
+        encodeStatusReportData->sequential = true;  //Query the encoded frame status in sequential.
+
+        // Don't hold the status list while Codechal is busy with a submission
+        uint16_t   numStatus = 1;
+        MOS_STATUS mosStatus = MOS_STATUS_SUCCESS;
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> codecHalLock(m_codecHalMutex);
+            mosStatus = m_encodeCtx->pCodecHal->GetStatusReport(encodeStatusReportData, numStatus);
+        }
+        lock.lock();
+
+        bool     finished = true;
+        uint32_t status   = 0;
+        if (MOS_STATUS_SUCCESS == mosStatus && CODECHAL_STATUS_SUCCESSFUL == encodeStatusReportData[0].codecStatus)
+        {
+            status = GetCodedBufferStatus(encodeStatusReportData);
+        }
+        else if (MOS_STATUS_SUCCESS == mosStatus && CODECHAL_STATUS_ERROR == encodeStatusReportData[0].codecStatus)
+        {
+            DDI_CODEC_ASSERTMESSAGE("Encoding failure due to HW issue");
+            status = VA_CODED_BUF_STATUS_BAD_BITSTREAM;
+        }
+        else if (!incomplete)
+        {
+            incomplete      = true;
+            incompleteStart = std::chrono::steady_clock::now();
+            finished        = false;
+        }
+        else if (std::chrono::steady_clock::now() - incompleteStart < incompleteTimeout)
+        {
+            finished = false;
+        }
+        else
+        {
+            DDI_CODEC_ASSERTMESSAGE("Something unexpected happened in HW, return error to application");
+            status = VA_CODED_BUF_STATUS_BAD_BITSTREAM;
+        }
+
+        if (!finished)
+        {
+            m_statusCond.wait_for(lock, incompleteInterval);
+            continue;
+        }
+        incomplete = false;
+
+        // Kept for AsyncStatusReport, which fills the buffer manager when the coded buffer is mapped
+        m_collectedStatus[updatePosition] = encodeStatusReportData[0];
+
+        if (UpdateStatusReportBuffer(encodeStatusReportData[0].bitstreamSize, status) != VA_STATUS_SUCCESS)
+        {
+            // Coded buffer was removed before being mapped, skip its entry
+            m_encodeCtx->statusReportBuf.ulUpdatePosition = (updatePosition + 1) % DDI_ENCODE_MAX_STATUS_REPORT_BUFFER;
+        }
+
+        m_statusCollected++;
+        m_statusCond.notify_all();
+    }
+}
+
+VAStatus DdiEncodeBase::StartStatusReportThread()
+{
+    DDI_CODEC_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    char *asyncStatusEnv = getenv("INTEL_MEDIA_ASYNC_ENCODE_STATUS");
+    if (asyncStatusEnv == nullptr || strcmp(asyncStatusEnv, "1") != 0)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    // FEI Enc/PreEnc share the status report queue with their own buffers
+    if (m_encodeCtx->codecFunction != CODECHAL_FUNCTION_ENC_PAK &&
+        m_encodeCtx->codecFunction != CODECHAL_FUNCTION_ENC_VDENC_PAK)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    DDI_CODEC_CHK_NULL(m_encodeCtx->pCodecHal, "Null m_encodeCtx->pCodecHal", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CODEC_CHK_NULL(m_encodeCtx->pCpDdiInterfaceNext, "Null m_encodeCtx->pCpDdiInterfaceNext", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    m_statusThreadExit  = false;
+    m_statusQueued      = 0;
+    m_statusSubmitted   = 0;
+    m_statusCollected   = 0;
+    try
+    {
+        m_collectedStatus.resize(DDI_ENCODE_MAX_STATUS_REPORT_BUFFER);
+        m_statusThread = std::thread(&DdiEncodeBase::StatusReportThreadProc, this);
+    }
+    catch (const std::exception &)
+    {
+        DDI_CODEC_NORMALMESSAGE("Failed to create status report thread, fall back to synchronous status report.");
+        m_collectedStatus.clear();
+        return VA_STATUS_SUCCESS;
+    }
+    m_asyncStatusReport = true;
+
+    return VA_STATUS_SUCCESS;
+}
+
+void DdiEncodeBase::StopStatusReportThread()
+{
+    if (!m_statusThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_statusMutex);
+        m_statusThreadExit = true;
+    }
+    m_statusCond.notify_all();
+    m_statusThread.join();
+    m_asyncStatusReport = false;
+    m_collectedStatus.clear();
+}
+
 VAStatus DdiEncodeBase::EncStatusReport(
     DDI_MEDIA_BUFFER    *mediaBuf,
     void                **buf)
@@ -418,6 +711,8 @@ VAStatus DdiEncodeBase::PreEncStatusReport(
 
 VAStatus DdiEncodeBase::RemoveFromStatusReportQueue(DDI_MEDIA_BUFFER *buf)
 {
+    std::lock_guard<std::mutex> lock(m_statusMutex);
+
     VAStatus eStatus = VA_STATUS_SUCCESS;
 
     DDI_CODEC_CHK_NULL(m_encodeCtx, "Null m_encodeCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
@@ -646,6 +941,13 @@ bool DdiEncodeBase::CodedBufferExistInStatusReport(DDI_MEDIA_BUFFER *buf)
         return false;
     }
 
+    // The status report thread updates the list when it is running
+    std::unique_lock<std::mutex> lock(m_statusMutex, std::defer_lock);
+    if (m_asyncStatusReport)
+    {
+        lock.lock();
+    }
+
     for (int32_t i = 0; i < DDI_ENCODE_MAX_STATUS_REPORT_BUFFER; i++)
     {
         if (m_encodeCtx->statusReportBuf.infos[i].pCodedBuf == (void *)buf->bo)
@@ -28,6 +28,10 @@
 #define __DDI_ENCODE_BASE_SPECIFIC_H__
 
 #include <va/va.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "ddi_codec_base_specific.h"
 #include "ddi_libva_encoder_specific.h"
 #include "codechal_setting.h"
@@ -89,6 +93,7 @@ public:
     //!
     virtual ~DdiEncodeBase()
     {
+        StopStatusReportThread();
         MOS_Delete(m_codechalSettings);
         m_codechalSettings = nullptr;
     };
@@ -123,6 +128,35 @@ public:
         DDI_MEDIA_BUFFER *mediaBuf,
         void             **buf);
 
+    //!
+    //! \brief    Query the slices already encoded into a coded buffer.
+    //! \details  Reports the slices PAK has completed for the oldest pending
+    //!           coded buffer. They start at the beginning of the coded buffer and
+    //!           are laid out back to back. Coded buffers behind the oldest pending
+    //!           one report no slices yet. A new BRC pass encodes the picture again,
+    //!           so slices reported with an earlier pass index are no longer valid.
+    //!
+    //! \param    [in] mediaBuf
+    //!           Pointer to the coded buffer
+    //! \param    [out] sliceSizes
+    //!           Array to receive the size in bytes of each completed slice
+    //! \param    [in] maxSlices
+    //!           Number of entries in sliceSizes
+    //! \param    [out] numSlices
+    //!           Number of completed slices
+    //! \param    [out] passIndex
+    //!           BRC pass of the completed slices
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    VAStatus QuerySliceProgress(
+        DDI_MEDIA_BUFFER *mediaBuf,
+        uint32_t         *sliceSizes,
+        uint32_t         maxSlices,
+        uint32_t         *numSlices,
+        uint32_t         *passIndex);
+
     //!
     //! \brief    Report Status for Enc buffer.
     //!
@@ -164,6 +198,26 @@ public:
     //!
     VAStatus RemoveFromStatusReportQueue(DDI_MEDIA_BUFFER *buf);
 
+    //!
+    //! \brief    Start the thread collecting status of finished frames
+    //! \details  When INTEL_MEDIA_ASYNC_ENCODE_STATUS=1, status of each frame is
+    //!           collected into status report list as soon as GPU finishes it,
+    //!           so mapping a coded buffer only looks up its own entry instead
+    //!           of parsing status reports of all preceding frames.
+    //!           Only enabled for ENC_PAK and ENC_VDENC_PAK functions.
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success or not enabled, else fail reason
+    //!
+    VAStatus StartStatusReportThread();
+
+    //!
+    //! \brief    Stop the thread collecting status of finished frames
+    //!
+    //! \return   void
+    //!
+    void StopStatusReportThread();
+
     //!
     //! \brief    Remove Enc Report Status from status report list.
     //!
@@ -579,6 +633,50 @@ protected:
     //! \return   void
     void CleanUpBufferandReturn(DDI_MEDIA_BUFFER *buf);
 
+    //!
+    //! \brief    Get coded buffer status from encode status reported by Codechal
+    //!
+    //! \param    [in] encodeStatusReportData
+    //!           Pointer to encode status reported by Codechal
+    //!
+    //! \return   uint32_t
+    //!           Status of VACodedBufferSegment
+    //!
+    uint32_t GetCodedBufferStatus(EncodeStatusReportData *encodeStatusReportData);
+
+    //!
+    //! \brief    Report Status for coded buffer collected by status report thread.
+    //!
+    //! \param    [in] mediaBuf
+    //!           Pointer to DDI_MEDIA_BUFFER
+    //! \param    [out] buf
+    //!           Pointer to buffer
+    //!
+    //! \return   VAStatus
+    //!           VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    VAStatus AsyncStatusReport(
+        DDI_MEDIA_BUFFER *mediaBuf,
+        void             **buf);
+
+    //!
+    //! \brief    Collect status of submitted frames in order until stopped.
+    //!
+    //! \return   void
+    //!
+    void StatusReportThreadProc();
+
+    std::thread             m_statusThread;                 //!< Thread collecting status of finished frames.
+    std::mutex              m_statusMutex;                  //!< Protects status report list when thread is running.
+    std::mutex              m_codecHalMutex;                //!< Serializes Codechal Execute and GetStatusReport.
+    std::condition_variable m_statusCond;                   //!< Signaled on new submission and on collected status.
+    bool                    m_asyncStatusReport = false;    //!< Flag for status report thread enabled.
+    bool                    m_statusThreadExit  = false;    //!< Flag to stop status report thread.
+    uint32_t                m_statusQueued      = 0;        //!< Number of frames added to status report list.
+    uint32_t                m_statusSubmitted   = 0;        //!< Number of frames submitted to Codechal.
+    uint32_t                m_statusCollected   = 0;        //!< Number of frames collected by status report thread.
+    std::vector<EncodeStatusReportData> m_collectedStatus;  //!< Status collected by the thread, per status report entry.
+
     bool    m_cpuFormat              = false;    //!< Flag for cpuFormat.
     bool    m_newSeqHeader           = false;    //!< Flag for new Sequence Header.
     bool    m_newPpsHeader           = false;    //!< Flag for new Pps Header.
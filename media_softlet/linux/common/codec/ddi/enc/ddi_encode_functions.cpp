@@ -292,6 +292,13 @@ VAStatus DdiEncodeFunctions::CreateContext (
         encCtx->RTtbl.iNumRenderTargets++;
     }
 
+    vaStatus = encCtx->m_encode->StartStatusReportThread();
+    if (vaStatus != VA_STATUS_SUCCESS)
+    {
+        CleanUp(encCtx);
+        return vaStatus;
+    }
+
     // convert PDDI_ENCODE_CONTEXT to VAContextID
     MosUtilities::MosLockMutex(&mediaCtx->EncoderMutex);
     PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vaContextHeapElmt = MediaLibvaUtilNext::DdiAllocPVAContextFromHeap(mediaCtx->pEncoderCtxHeap);
@@ -331,6 +338,8 @@ VAStatus DdiEncodeFunctions::DestroyContext (
 
     if (nullptr != encCtx->m_encode)
     {
+        // Stop collecting status before Codechal is destroyed
+        encCtx->m_encode->StopStatusReportThread();
         encCtx->m_encode->FreeCompBuffer();
         if(nullptr != encCtx->m_encode->m_codechalSettings)
         {
@@ -560,6 +569,35 @@ VAStatus DdiEncodeFunctions::MapBufferInternal(
     return vaStatus;
 }
 
+VAStatus DdiEncodeFunctions::QuerySliceProgress(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    VABufferID         bufId,
+    uint32_t           *sliceSizes,
+    uint32_t           maxSlices,
+    uint32_t           *numSlices,
+    uint32_t           *passIndex)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    DDI_CODEC_CHK_NULL(mediaCtx, "nullptr mediaCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    DDI_MEDIA_BUFFER *buf = MediaLibvaCommonNext::GetBufferFromVABufferID(mediaCtx, bufId);
+    DDI_CODEC_CHK_NULL(buf, "nullptr buf", VA_STATUS_ERROR_INVALID_BUFFER);
+    if (buf->uiType != VAEncCodedBufferType)
+    {
+        return VA_STATUS_ERROR_INVALID_BUFFER;
+    }
+
+    void *ctxPtr = MediaLibvaCommonNext::GetCtxFromVABufferID(mediaCtx, bufId);
+    DDI_CODEC_CHK_NULL(ctxPtr, "nullptr ctxPtr", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    encode::PDDI_ENCODE_CONTEXT encCtx = encode::GetEncContextFromPVOID(ctxPtr);
+    DDI_CODEC_CHK_NULL(encCtx, "nullptr encCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CODEC_CHK_NULL(encCtx->m_encode, "nullptr encCtx->m_encode", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    return encCtx->m_encode->QuerySliceProgress(buf, sliceSizes, maxSlices, numSlices, passIndex);
+}
+
 VAStatus DdiEncodeFunctions::UnmapBuffer (
     DDI_MEDIA_CONTEXT   *mediaCtx,
     VABufferID          buf_id
@@ -172,6 +172,34 @@ public:
         uint32_t            flag
     ) override;
 
+    //!
+    //! \brief   Query the slices already encoded into a coded buffer
+    //!
+    //! \param   [in] mediaCtx
+    //!          Pointer to media driver context
+    //! \param   [in] bufId
+    //!          VA coded buffer id
+    //! \param   [out] sliceSizes
+    //!          Array to receive the size in bytes of each completed slice
+    //! \param   [in] maxSlices
+    //!          Number of entries in sliceSizes
+    //! \param   [out] numSlices
+    //!          Number of completed slices
+    //! \param   [out] passIndex
+    //!          BRC pass of the completed slices
+    //!
+    //! \return  VAStatus
+    //!     VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual VAStatus QuerySliceProgress(
+        PDDI_MEDIA_CONTEXT mediaCtx,
+        VABufferID         bufId,
+        uint32_t           *sliceSizes,
+        uint32_t           maxSlices,
+        uint32_t           *numSlices,
+        uint32_t           *passIndex
+    ) override;
+
     //!
     //! \brief  Unmap buffer
     //!
@@ -347,6 +347,18 @@ VAStatus DdiMediaFunctions::QuerySurfaceError(
     return VA_STATUS_ERROR_UNIMPLEMENTED;
 }
 
+VAStatus DdiMediaFunctions::QuerySliceProgress(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    VABufferID         bufId,
+    uint32_t           *sliceSizes,
+    uint32_t           maxSlices,
+    uint32_t           *numSlices,
+    uint32_t           *passIndex)
+{
+    DDI_ASSERTMESSAGE("Unsupported function call.");
+    return VA_STATUS_ERROR_UNIMPLEMENTED;
+}
+
 VAStatus DdiMediaFunctions::PutSurface(
     VADriverContextP ctx,
     VASurfaceID      surface,
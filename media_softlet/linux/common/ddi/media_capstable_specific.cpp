@@ -84,10 +84,10 @@ VAStatus MediaCapsTableSpecific::Init(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_ERROR_INVALID_PARAMETER;
     }
 
-    for (auto profileMapIter: *m_profileMap)
+    for (const auto &profileMapIter: *m_profileMap)
     {
         auto profile = profileMapIter.first;
-        for(auto entrypointMapIter: *profileMapIter.second)
+        for(const auto &entrypointMapIter: *profileMapIter.second)
         {
             auto entrypoint     = entrypointMapIter.first;
             auto entrypointData = entrypointMapIter.second;
@@ -229,7 +229,7 @@ VAStatus MediaCapsTableSpecific::CreateConfig(
     DDI_UNUSED(configId);
 
     VAStatus ret = VA_STATUS_ERROR_UNSUPPORTED_PROFILE;
-    for (auto configItem : m_configList)
+    for (const auto &configItem : m_configList)
     {
         // check profile, entrypoint here
         if (configItem.profile == profile)
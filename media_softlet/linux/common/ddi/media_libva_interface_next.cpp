@@ -314,6 +314,15 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
 #endif
     mediaCtx->modularizedGpuCtxEnabled = true;
 
+    // Startup trace: time spent in each init stage, reported after init completes
+    uint64_t initStageTime[InitStageCount] = {};
+    uint64_t initStageStart = MosUtilities::MosGetCurTime();
+    auto endInitStage = [&](InitStage stage) {
+        uint64_t now          = MosUtilities::MosGetCurTime();
+        initStageTime[stage]  = now - initStageStart;
+        initStageStart        = now;
+    };
+
     mediaCtx->m_userSettingPtr  = std::make_shared<MediaUserSetting::MediaUserSetting>();
 
     MOS_CONTEXT mosCtx          = {};
@@ -322,6 +331,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
 
     MosInterface::InitOsUtilities(&mosCtx);
     MosOcaInterfaceSpecific::InitInterface(&mosCtx);
+    endInitStage(InitStageOsUtilities);
 
     mediaCtx->pGtSystemInfo = (MEDIA_SYSTEM_INFO *)MOS_AllocAndZeroMemory(sizeof(MEDIA_SYSTEM_INFO));
     if (nullptr == mediaCtx->pGtSystemInfo)
@@ -358,6 +368,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
     mediaCtx->pMediaMemDecompState      = *mosCtx.ppMediaMemDecompState;
 #endif
     mediaCtx->pMediaCopyState           = *mosCtx.ppMediaCopyState;
+    endInitStage(InitStageDeviceContext);
 
     if (HeapInitialize(mediaCtx) != VA_STATUS_SUCCESS)
     {
@@ -365,6 +376,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    endInitStage(InitStageHeap);
 
     mediaCtx->m_hwInfo = MediaInterfacesHwInfoDevice::CreateFactory(mediaCtx->platform);
     if(!mediaCtx->m_hwInfo)
@@ -374,6 +386,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    endInitStage(InitStageHwInfo);
 
     mediaCtx->m_capsNext = MediaLibvaCapsNext::CreateCaps(mediaCtx);
     if (!mediaCtx->m_capsNext)
@@ -390,6 +403,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
     }
 
     ctx->max_image_formats = mediaCtx->m_capsNext->GetImageFormatsMaxNum();
+    endInitStage(InitStageCaps);
 
 #if !defined(ANDROID) && defined(X11_FOUND)
     MediaLibvaUtilNext::InitMutex(&mediaCtx->PutSurfaceRenderMutex);
@@ -412,6 +426,7 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
 #endif
 
     MediaLibvaUtilNext::SetMediaResetEnableFlag(mediaCtx);
+    endInitStage(InitStageOutput);
 
     if (InitCompList(mediaCtx) != VA_STATUS_SUCCESS)
     {
@@ -429,12 +444,39 @@ VAStatus MediaLibvaInterfaceNext::Initialize (
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
+    endInitStage(InitStageCompList);
+
+    TraceInitStages(initStageTime);
 
     MosUtilities::MosUnlockMutex(&m_GlobalMutex);
 
     return VA_STATUS_ERROR_UNIMPLEMENTED;
 }
 
+void MediaLibvaInterfaceNext::TraceInitStages(const uint64_t (&stageTime)[InitStageCount])
+{
+    static const char *stageNames[InitStageCount] =
+    {
+        "OsUtilities",
+        "DeviceContext",
+        "Heap",
+        "HwInfo",
+        "Caps",
+        "Output",
+        "CompList",
+    };
+
+    uint64_t total = 0;
+    for (int i = 0; i < InitStageCount; i++)
+    {
+        total += stageTime[i];
+        DDI_NORMALMESSAGE("Init stage %s: %llu us", stageNames[i], (unsigned long long)stageTime[i]);
+    }
+    DDI_NORMALMESSAGE("Init total: %llu us", (unsigned long long)total);
+
+    MOS_TraceEventExt(EVENT_VA_INIT, EVENT_TYPE_INFO, stageTime, sizeof(stageTime), &total, sizeof(total));
+}
+
 VAStatus MediaLibvaInterfaceNext::InitCompList(PDDI_MEDIA_CONTEXT mediaCtx)
 {
     DDI_FUNC_ENTER;
@@ -5212,6 +5254,36 @@ VAStatus MediaLibvaInterfaceNext::MapBufferInternal(
     return vaStatus;
 }
 
+VAStatus MediaLibvaInterfaceNext::QuerySliceProgress(
+    VADriverContextP ctx,
+    VABufferID       bufId,
+    uint32_t         *sliceSizes,
+    uint32_t         maxSlices,
+    uint32_t         *numSlices,
+    uint32_t         *passIndex)
+{
+    DDI_FUNC_ENTER;
+
+    DDI_CHK_NULL(ctx,        "nullptr ctx",        VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_NULL(sliceSizes, "nullptr sliceSizes", VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CHK_NULL(numSlices,  "nullptr numSlices",  VA_STATUS_ERROR_INVALID_PARAMETER);
+    DDI_CHK_NULL(passIndex,  "nullptr passIndex",  VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    PDDI_MEDIA_CONTEXT mediaCtx = GetMediaContext(ctx);
+    DDI_CHK_NULL(mediaCtx,              "nullptr mediaCtx",              VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_NULL(mediaCtx->pBufferHeap, "nullptr mediaCtx->pBufferHeap", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_LESS((uint32_t)bufId, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "Invalid bufferId", VA_STATUS_ERROR_INVALID_BUFFER);
+
+    uint32_t ctxType = MediaLibvaCommonNext::GetCtxTypeFromVABufferID(mediaCtx, bufId);
+    if (ctxType != DDI_MEDIA_CONTEXT_TYPE_ENCODER)
+    {
+        return VA_STATUS_ERROR_INVALID_BUFFER;
+    }
+
+    DDI_CHK_NULL(mediaCtx->m_compList[CompEncode], "nullptr complist", VA_STATUS_ERROR_INVALID_CONTEXT);
+    return mediaCtx->m_compList[CompEncode]->QuerySliceProgress(mediaCtx, bufId, sliceSizes, maxSlices, numSlices, passIndex);
+}
+
 VAStatus MediaLibvaInterfaceNext::UnmapBuffer(
     VADriverContextP ctx,
     VABufferID       bufId)
@@ -2169,6 +2169,37 @@ public:
         void              **buf,
         uint32_t          flag);
 
+    //!
+    //! \brief  Query the slices already encoded into a coded buffer
+    //! \details    Reports the slices PAK has completed for a picture still being
+    //!             encoded. The slices start at the beginning of the coded buffer and
+    //!             are laid out back to back. A new BRC pass encodes the picture again,
+    //!             so slices reported with an earlier pass index are no longer valid.
+    //!
+    //! \param  [in] ctx
+    //!         Pointer to VA driver context
+    //! \param  [in] bufId
+    //!         VA coded buffer ID
+    //! \param  [out] sliceSizes
+    //!         Array to receive the size in bytes of each completed slice
+    //! \param  [in] maxSlices
+    //!         Number of entries in sliceSizes
+    //! \param  [out] numSlices
+    //!         Number of completed slices
+    //! \param  [out] passIndex
+    //!         BRC pass of the completed slices
+    //!
+    //! \return VAStatus
+    //!     VA_STATUS_SUCCESS if success, else fail reason
+    //!
+    static VAStatus QuerySliceProgress(
+        VADriverContextP  ctx,
+        VABufferID        bufId,
+        uint32_t          *sliceSizes,
+        uint32_t          maxSlices,
+        uint32_t          *numSlices,
+        uint32_t          *passIndex);
+
     //! \brief  Unmap buffer
     //!
     //! \param  [in] ctx
@@ -2198,6 +2229,29 @@ public:
         PDDI_MEDIA_CONTEXT mediaCtx,
         DDI_MEDIA_SURFACE  *mediaSurface);
 
+    //!
+    //! \brief  Stages of driver initialization recorded in startup trace
+    //!
+    enum InitStage
+    {
+        InitStageOsUtilities = 0,
+        InitStageDeviceContext,
+        InitStageHeap,
+        InitStageHwInfo,
+        InitStageCaps,
+        InitStageOutput,
+        InitStageCompList,
+        InitStageCount
+    };
+
+    //!
+    //! \brief  Report time spent in each stage of driver initialization
+    //!
+    //! \param  [in] stageTime
+    //!         Time of each init stage in us, indexed by InitStage
+    //!
+    static void TraceInitStages(const uint64_t (&stageTime)[InitStageCount]);
+
 public:
     // Global mutex
     static MEDIA_MUTEX_T m_GlobalMutex;
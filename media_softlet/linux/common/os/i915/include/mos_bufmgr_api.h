@@ -253,6 +253,12 @@ struct mos_drm_uc_version {
     uint32_t minor_version;
 };
 
+/**
+ * On xe, the vm bind of a bo from mos_bo_alloc is deferred to the next exec.
+ * A bind failure then fails every exec using the bo with -EFAULT, while execs
+ * which don't use it go on. Userptr and prime bos are bound before they are
+ * returned, so their creation returns nullptr on a bind failure.
+ */
 struct mos_linux_bo *mos_bo_alloc(struct mos_bufmgr *bufmgr,
                                 struct mos_drm_bo_alloc *alloc);
 struct mos_linux_bo *mos_bo_alloc_userptr(struct mos_bufmgr *bufmgr,
@@ -658,17 +658,6 @@ void GpuContextSpecificNext::Clear()
 
     MOS_TraceEventExt(EVENT_GPU_CONTEXT_DESTROY, EVENT_TYPE_START,
                       m_i915Context, sizeof(void *), nullptr, 0);
-    // hanlde the status buf bundled w/ the specified gpucontext
-    if (m_statusBufferResource && m_statusBufferResource->pGfxResourceNext)
-    {
-        if (m_statusBufferResource->pGfxResourceNext->Unlock(m_osContext) != MOS_STATUS_SUCCESS)
-        {
-            MOS_OS_ASSERTMESSAGE("failed to unlock the status buf bundled w/ the specified gpucontext");
-        }
-        m_statusBufferResource->pGfxResourceNext->Free(m_osContext, 0);
-        MOS_Delete(m_statusBufferResource->pGfxResourceNext);
-    }
-    MOS_FreeMemAndSetNull(m_statusBufferResource);
 
     MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
 
@@ -687,6 +676,24 @@ void GpuContextSpecificNext::Clear()
     m_cmdBufPool.clear();
 
     MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
+
+    // hanlde the status buf bundled w/ the specified gpucontext
+    // all command buffers are idle now, so it may be handed to the next gpucontext of the device
+    GpuContextMgrNext *gpuContextMgr = m_osContext ? m_osContext->GetGpuContextMgr() : nullptr;
+    if (m_cmdBufMgr && gpuContextMgr && gpuContextMgr->ReleaseStatusBuffer(m_statusBufferResource))
+    {
+        m_statusBufferResource = nullptr;
+    }
+    if (m_statusBufferResource && m_statusBufferResource->pGfxResourceNext)
+    {
+        if (m_statusBufferResource->pGfxResourceNext->Unlock(m_osContext) != MOS_STATUS_SUCCESS)
+        {
+            MOS_OS_ASSERTMESSAGE("failed to unlock the status buf bundled w/ the specified gpucontext");
+        }
+        m_statusBufferResource->pGfxResourceNext->Free(m_osContext, 0);
+        MOS_Delete(m_statusBufferResource->pGfxResourceNext);
+    }
+    MOS_FreeMemAndSetNull(m_statusBufferResource);
     MosUtilities::MosDestroyMutex(m_cmdBufPoolMutex);
     m_cmdBufPoolMutex = nullptr;
     MOS_SafeFreeMemory(m_commandBuffer);
@@ -1931,6 +1938,19 @@ MOS_STATUS GpuContextSpecificNext::AllocateGPUStatusBuf()
 {
     MOS_OS_FUNCTION_ENTER;
 
+    // Take a status buf retained from a destroyed gpucontext if any, already mapped
+    GpuContextMgrNext *gpuContextMgr = m_osContext ? m_osContext->GetGpuContextMgr() : nullptr;
+    if (gpuContextMgr)
+    {
+        m_statusBufferResource = gpuContextMgr->AcquireStatusBuffer();
+        if (m_statusBufferResource)
+        {
+            // Tags of the previous gpucontext must not read as completed work of this one
+            MosUtilities::MosZeroMemory(m_statusBufferResource->pData, sizeof(MOS_GPU_STATUS_DATA));
+            return MOS_STATUS_SUCCESS;
+        }
+    }
+
     m_statusBufferResource = (PMOS_RESOURCE)MOS_AllocAndZeroMemory(sizeof(MOS_RESOURCE));
     MOS_OS_CHK_NULL_RETURN(m_statusBufferResource);
 
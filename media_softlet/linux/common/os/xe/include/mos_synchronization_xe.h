@@ -33,6 +33,8 @@
 #include <map>
 #include <queue>
 #include <list>
+#include <unordered_map>
+#include <utility>
 #include "xe_drm.h"
 
 #if defined(__cplusplus)
@@ -90,6 +92,88 @@ struct mos_xe_bo_dep
     uint64_t exec_timeline_index;
 };
 
+/**
+ * Per bo dependency map, keyed by dummy exec queue id.
+ *
+ * Almost all bos are only touched by a few exec queues, so the entries are kept
+ * in a small inline array and searched linearly; once more exec queues share the
+ * bo, the entries spill into a heap array indexed by a hash map. Entries stay
+ * contiguous in both cases so callers can walk them like a std::map.
+ */
+struct mos_xe_bo_dep_map
+{
+    /**
+     * Number of entries held inline before spilling to the heap.
+     */
+#define MOS_XE_BO_DEP_INLINE_SIZE 4
+
+    typedef std::pair<uint32_t, struct mos_xe_bo_dep> entry;
+
+    mos_xe_bo_dep_map() : count(0) {}
+
+    entry *begin() { return spill.empty() ? inline_entries : spill.data(); }
+    entry *end() { return begin() + size(); }
+    uint32_t size() const { return spill.empty() ? count : (uint32_t)spill.size(); }
+
+    /**
+     * Get the dep of given exec queue, nullptr if the bo has no dep on it.
+     */
+    struct mos_xe_bo_dep *find(uint32_t engine_id)
+    {
+        if (spill.empty())
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                if (inline_entries[i].first == engine_id)
+                {
+                    return &inline_entries[i].second;
+                }
+            }
+            return nullptr;
+        }
+
+        auto it = spill_index.find(engine_id);
+        return it == spill_index.end() ? nullptr : &spill[it->second].second;
+    }
+
+    /**
+     * Add or replace the dep of given exec queue.
+     */
+    void set(uint32_t engine_id, const struct mos_xe_bo_dep &bo_dep)
+    {
+        struct mos_xe_bo_dep *curr = find(engine_id);
+        if (curr)
+        {
+            *curr = bo_dep;
+            return;
+        }
+
+        if (spill.empty() && count < MOS_XE_BO_DEP_INLINE_SIZE)
+        {
+            inline_entries[count++] = entry(engine_id, bo_dep);
+            return;
+        }
+
+        if (spill.empty())
+        {
+            spill.assign(inline_entries, inline_entries + count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                spill_index[inline_entries[i].first] = i;
+            }
+            count = 0;
+        }
+        spill_index[engine_id] = (uint32_t)spill.size();
+        spill.push_back(entry(engine_id, bo_dep));
+    }
+
+private:
+    entry inline_entries[MOS_XE_BO_DEP_INLINE_SIZE];
+    uint32_t count;
+    std::vector<entry> spill;
+    std::unordered_map<uint32_t, uint32_t> spill_index;
+};
+
 int mos_sync_syncobj_create(int fd, uint32_t flags);
 int mos_sync_syncobj_destroy(int fd, uint32_t handle);
 int mos_sync_syncobj_reset(int fd, uint32_t *handles, uint32_t count);
@@ -110,8 +194,8 @@ void mos_sync_update_timeline_dep(struct mos_xe_dep *dep);
 int mos_sync_update_exec_syncs_from_timeline_deps(uint32_t curr_engine,
             uint32_t lst_write_engine, uint32_t flags,
             std::set<uint32_t> &engine_ids,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps,
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps,
             std::vector<drm_xe_sync> &syncs);
 int mos_sync_update_exec_syncs_from_handle(int fd,
             uint32_t bo_handle, uint32_t flags,
@@ -122,14 +206,15 @@ struct mos_xe_dep *mos_sync_update_exec_syncs_from_timeline_queue(int fd,
             std::vector<struct drm_xe_sync> &syncs);
 int mos_sync_update_bo_deps(uint32_t curr_engine,
             uint32_t flags, mos_xe_dep *dep,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps);
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps);
 void mos_sync_get_bo_wait_timeline_deps(std::set<uint32_t> &engine_ids,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps,
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps,
             std::map<uint32_t, uint64_t> &max_timeline_data,
             uint32_t lst_write_engine,
             uint32_t rw_flags);
+void mos_sync_dedup_exec_syncs(std::vector<struct drm_xe_sync> &syncs);
 void mos_sync_clear_dep_queue(int fd, std::queue<struct mos_xe_dep*> &queue);
 void mos_sync_clear_dep_list(int fd, std::list<struct mos_xe_dep*> &temp_list);
 
@@ -41,6 +41,7 @@
 #include <sys/syscall.h>
 #include <sys/utsname.h>
 #include <termios.h>
+#include <time.h>
 #ifndef ETIME
 #define ETIME ETIMEDOUT
 #endif
@@ -157,6 +158,15 @@ struct mos_xe_context {
     uint32_t reset_count;
 };
 
+/**
+ * Size class of the bo reuse cache.
+ * Cached bos of the same size class are kept in free order, oldest first.
+ */
+struct mos_xe_bo_bucket {
+    drmMMListHead head;
+    unsigned long size;
+};
+
 typedef struct mos_xe_bufmgr_gem {
     struct mos_bufmgr bufmgr;
 
@@ -222,6 +232,45 @@ typedef struct mos_xe_bufmgr_gem {
 #define EXEC_QUEUE_TIMESLICE_DEFAULT    -1
 #define EXEC_QUEUE_TIMESLICE_MAX        100000 //100ms
     int32_t exec_queue_timeslice;
+
+    /**
+     * Bo reuse cache.
+     * Released bos are kept bound in the vm and handed out again to allocations
+     * of the same size class, placement, cpu caching mode and pat_index, which
+     * saves the gem create, vm bind and the bind fence wait.
+     * Protected by m_lock.
+     */
+#define MOS_XE_BO_CACHE_BUCKET_MAX      64
+#define MOS_XE_BO_CACHE_MAX_BO_SIZE     (64 * 1024 * 1024)
+#define MOS_XE_BO_CACHE_MAX_TOTAL_SIZE  (256ull * 1024 * 1024)
+    bool bo_reuse = false;
+    struct mos_xe_bo_bucket cache_bucket[MOS_XE_BO_CACHE_BUCKET_MAX] = {};
+    int num_buckets = 0;
+    /** all cached bos in free order, used for trim */
+    drmMMListHead cache_lru = {};
+    /** total size of cached bos */
+    uint64_t cache_size = 0;
+    /** time of the last trim of aged cached bos */
+    time_t cache_time = 0;
+
+    /**
+     * Vm bind ops queued by bo creation, submitted in one DRM_IOCTL_XE_VM_BIND
+     * before the next exec instead of one synchronous bind per bo.
+     * Protected by m_lock.
+     */
+    std::vector<struct drm_xe_vm_bind_op> pending_binds;
+    /**
+     * Out syncobjs of submitted vm binds not known as signaled yet;
+     * exec adds them as in-fences until they signal.
+     * Protected by m_lock.
+     */
+    std::vector<uint32_t> bind_syncobjs;
+    /**
+     * Vm addresses of bos whose queued bind was rejected by KMD;
+     * such bos are not bound, exec using them fails and free skips the unbind.
+     * Protected by m_lock.
+     */
+    std::set<uint64_t> failed_binds;
 } mos_xe_bufmgr_gem;
 
 typedef struct mos_xe_exec_bo {
@@ -385,7 +434,7 @@ typedef struct mos_xe_bo_gem {
      * Exec will check opration flags to get the dep from the map to add into exec sync array and updated the map after exec.
      * Refer to exec call to get more details.
      */
-    std::map<uint32_t, struct mos_xe_bo_dep> read_deps;
+    struct mos_xe_bo_dep_map read_deps;
 
     /**
      * Write dependents, pair of dummy EXEC_QUEUE_ID and mos_xe_bo_dep
@@ -393,7 +442,17 @@ typedef struct mos_xe_bo_gem {
      * Exec will check opration flags to get the dep from the map to add into exec sync array and updated the map after exec.
      * Refer to exec call to get more details.
      */
-    std::map<uint32_t, struct mos_xe_bo_dep> write_deps;
+    struct mos_xe_bo_dep_map write_deps;
+
+    /**
+     * Links in bucket list and lru list when this bo is in the reuse cache.
+     */
+    drmMMListHead cache_head;
+    drmMMListHead cache_lru_head;
+    /**
+     * Time when this bo is put into the reuse cache.
+     */
+    time_t free_time;
 
 } mos_xe_bo_gem;
 
@@ -415,6 +474,8 @@ static drmMMListHead bufmgr_list = { &bufmgr_list, &bufmgr_list };
 
 static struct drm_xe_query_gt_list *__mos_query_gt_list_xe(int fd);
 static void mos_bo_free_xe(struct mos_linux_bo *bo);
+static int mos_gem_bo_busy_xe(struct mos_linux_bo *bo);
+static bool __mos_bo_cache_put_xe(struct mos_linux_bo *bo);
 static int mos_query_engines_count_xe(struct mos_bufmgr *bufmgr, unsigned int *nengine);
 int mos_query_engines_xe(struct mos_bufmgr *bufmgr,
                       __u16 engine_class,
@@ -804,7 +865,10 @@ drm_export void mos_bo_unreference_xe(struct mos_linux_bo *bo)
 
         DRMLISTDEL(&bo_gem->name_list);
 
-        mos_bo_free_xe(bo);
+        if (!__mos_bo_cache_put_xe(bo))
+        {
+            mos_bo_free_xe(bo);
+        }
     }
 }
 
@@ -1228,42 +1292,547 @@ static int __mos_vm_bind_xe(int fd, uint32_t vm_id, uint32_t exec_queue_id, uint
     return ret;
 }
 
-static int mos_vm_bind_sync_xe(int fd, uint32_t vm_id, uint32_t bo, uint64_t offset,
+static int mos_vm_bind_async_xe(int fd, uint32_t vm_id, uint32_t bo, uint64_t offset,
+        uint64_t addr, uint64_t size, uint16_t pat_index, uint32_t op,
+        struct drm_xe_sync *sync, uint32_t num_syncs)
+{
+    return __mos_vm_bind_xe(fd, vm_id, 0, bo, offset, addr, size, pat_index,
+                op, 0, sync, num_syncs,    0);
+}
+
+/**
+ * Queue a vm bind op, it is submitted by __mos_vm_bind_flush_xe before next exec.
+ */
+static void
+__mos_vm_bind_queue_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, uint32_t bo, uint64_t offset,
         uint64_t addr, uint64_t size, uint16_t pat_index, uint32_t op)
 {
-    struct drm_xe_sync sync;
+    struct drm_xe_vm_bind_op bind;
+
+    memclear(bind);
+    bind.obj = bo;
+    bind.obj_offset = offset;
+    bind.range = size;
+    bind.pat_index = pat_index;
+    bind.addr = addr;
+    bind.op = op;
+
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+    bufmgr_gem->pending_binds.push_back(bind);
+}
+
+/**
+ * Drop the queued bind of @addr if the bo is released before any exec.
+ * Returns true if the bind is still pending or has failed, which means nothing to unbind.
+ */
+static bool
+__mos_vm_bind_cancel_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, uint64_t addr)
+{
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+
+    if (bufmgr_gem->failed_binds.erase(addr))
+    {
+        return true;
+    }
+
+    for (auto it = bufmgr_gem->pending_binds.begin(); it != bufmgr_gem->pending_binds.end(); it++)
+    {
+        if (it->addr == addr)
+        {
+            bufmgr_gem->pending_binds.erase(it);
+            return true;
+        }
+    }
+
+    return false;
+}
 
+/**
+ * Submit vm binds in one ioctl with an out syncobj.
+ * Must be called with m_lock held.
+ */
+static int
+__mos_vm_bind_submit_xe(struct mos_xe_bufmgr_gem *bufmgr_gem,
+            struct drm_xe_vm_bind_op *binds, uint32_t num_binds)
+{
+    struct drm_xe_sync sync;
     memclear(sync);
     sync.flags = DRM_XE_SYNC_FLAG_SIGNAL;
     sync.type = DRM_XE_SYNC_TYPE_SYNCOBJ;
-    sync.handle = mos_sync_syncobj_create(fd, 0);
+    sync.handle = mos_sync_syncobj_create(bufmgr_gem->fd, 0);
 
-    int ret = __mos_vm_bind_xe(fd, vm_id, 0, bo, offset, addr, size, pat_index,
-                op, 0, &sync, 1,  0);
-    if (ret)
+    struct drm_xe_vm_bind bind;
+    memclear(bind);
+    bind.vm_id = bufmgr_gem->vm_id;
+    bind.exec_queue_id = 0;
+    bind.num_binds = num_binds;
+    if (1 == num_binds)
+    {
+        bind.bind = binds[0];
+    }
+    else
     {
-        MOS_DRM_ASSERTMESSAGE("ret:%d, error:%d", ret, -errno);
-        mos_sync_syncobj_destroy(fd, sync.handle);
-        return ret;
+        bind.vector_of_binds = (uintptr_t)binds;
     }
+    bind.num_syncs = 1;
+    bind.syncs = (uintptr_t)&sync;
 
-    ret = mos_sync_syncobj_wait_err(fd, &sync.handle, 1, INT64_MAX, 0, NULL);
+    int ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_XE_VM_BIND, &bind);
     if (ret)
     {
-        MOS_DRM_ASSERTMESSAGE("syncobj_wait error:%d", -errno);
+        ret = -errno;
+        mos_sync_syncobj_destroy(bufmgr_gem->fd, sync.handle);
+    }
+    else
+    {
+        bufmgr_gem->bind_syncobjs.push_back(sync.handle);
+    }
+
+    return ret;
+}
+
+/**
+ * Submit all queued vm binds in one ioctl.
+ * KMD rejects the whole array if one op fails, so on failure the binds are
+ * retried one by one; the bos of the binds still failing are recorded in
+ * failed_binds, the other bos stay bound.
+ * Must be called with m_lock held.
+ */
+static void
+__mos_vm_bind_flush_xe(struct mos_xe_bufmgr_gem *bufmgr_gem)
+{
+    uint32_t num_binds = bufmgr_gem->pending_binds.size();
+    if (0 == num_binds)
+    {
+        return;
     }
 
-    mos_sync_syncobj_destroy(fd, sync.handle);
+    int ret = __mos_vm_bind_submit_xe(bufmgr_gem, bufmgr_gem->pending_binds.data(), num_binds);
+    if (ret && num_binds > 1)
+    {
+        MOS_DRM_NORMALMESSAGE("Failed to bind vm in batch, vm_id:%d, num_binds:%d, errno(%d), retry one by one",
+            bufmgr_gem->vm_id, num_binds, ret);
+
+        for (auto &op : bufmgr_gem->pending_binds)
+        {
+            ret = __mos_vm_bind_submit_xe(bufmgr_gem, &op, 1);
+            if (ret)
+            {
+                MOS_DRM_ASSERTMESSAGE("Failed to bind vm, vm_id:%d, bo_handle:%d, addr:0x%lx, size:%ld, errno(%d)",
+                    bufmgr_gem->vm_id, op.obj, op.addr, op.range, ret);
+                bufmgr_gem->failed_binds.insert(op.addr);
+            }
+        }
+    }
+    else if (ret)
+    {
+        struct drm_xe_vm_bind_op &op = bufmgr_gem->pending_binds[0];
+        MOS_DRM_ASSERTMESSAGE("Failed to bind vm, vm_id:%d, bo_handle:%d, addr:0x%lx, size:%ld, errno(%d)",
+            bufmgr_gem->vm_id, op.obj, op.addr, op.range, ret);
+        bufmgr_gem->failed_binds.insert(op.addr);
+    }
+
+    bufmgr_gem->pending_binds.clear();
+}
+
+/**
+ * Submit the queued vm binds now instead of at next exec, so that a bind error of
+ * @addr reaches the creator of a shared bo rather than an unrelated exec.
+ * Returns 0 if @addr is bound, -EFAULT if its bind failed.
+ */
+static int
+__mos_vm_bind_sync_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, uint64_t addr)
+{
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+
+    __mos_vm_bind_flush_xe(bufmgr_gem);
+
+    return bufmgr_gem->failed_binds.count(addr) ? -EFAULT : 0;
+}
+
+/**
+ * Check whether any bo used by the exec failed to bind to vm.
+ * Must be called with m_lock held.
+ */
+static bool
+__mos_vm_bind_failed_xe(struct mos_xe_bufmgr_gem *bufmgr_gem,
+            struct mos_linux_bo **bo, int num_bo,
+            std::vector<mos_xe_exec_bo> &exec_list)
+{
+    if (bufmgr_gem->failed_binds.empty())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < num_bo; i++)
+    {
+        if (bufmgr_gem->failed_binds.count(bo[i]->offset64))
+        {
+            return true;
+        }
+    }
+
+    for (auto &exec_bo : exec_list)
+    {
+        if (exec_bo.bo && bufmgr_gem->failed_binds.count(exec_bo.bo->offset64))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Add the out syncobjs of submitted vm binds into exec syncs as in-fences,
+ * and release the ones already signaled.
+ * Must be called with m_lock held.
+ */
+static void
+__mos_vm_bind_update_exec_syncs_xe(struct mos_xe_bufmgr_gem *bufmgr_gem,
+            std::vector<struct drm_xe_sync> &syncs)
+{
+    for (auto it = bufmgr_gem->bind_syncobjs.begin(); it != bufmgr_gem->bind_syncobjs.end();)
+    {
+        uint32_t handle = *it;
+        if (MOS_XE_SUCCESS == mos_sync_syncobj_wait_err(bufmgr_gem->fd, &handle, 1, 0, 0, nullptr))
+        {
+            mos_sync_syncobj_destroy(bufmgr_gem->fd, handle);
+            it = bufmgr_gem->bind_syncobjs.erase(it);
+            continue;
+        }
+
+        struct drm_xe_sync sync;
+        memclear(sync);
+        sync.type = DRM_XE_SYNC_TYPE_SYNCOBJ;
+        sync.handle = handle;
+        syncs.push_back(sync);
+        it++;
+    }
+}
+
+/**
+ * Unbind bo from vm without waiting for its rendering on CPU:
+ * the read and write deps of bo are passed as in-fences of the unbind,
+ * so the unbind is deferred by KMD until the last use of bo retires.
+ */
+static int
+__mos_vm_unbind_deferred_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, struct mos_xe_bo_gem *bo_gem)
+{
+    std::map<uint32_t, uint64_t> timeline_data; //pair(syncobj, point)
+    std::set<uint32_t> exec_queue_ids;
+    std::vector<struct drm_xe_sync> syncs;
+    int ret;
+
+    bufmgr_gem->m_lock.lock();
+    bufmgr_gem->sync_obj_rw_lock.lock_shared();
+    MOS_XE_GET_KEYS_FROM_MAP(bufmgr_gem->global_ctx_info, exec_queue_ids);
+
+    mos_sync_get_bo_wait_timeline_deps(exec_queue_ids,
+                bo_gem->read_deps,
+                bo_gem->write_deps,
+                timeline_data,
+                bo_gem->last_exec_write_exec_queue,
+                EXEC_OBJECT_READ_XE | EXEC_OBJECT_WRITE_XE);
+
+    for (auto it : timeline_data)
+    {
+        struct drm_xe_sync sync;
+        memclear(sync);
+        sync.type = DRM_XE_SYNC_TYPE_TIMELINE_SYNCOBJ;
+        sync.handle = it.first;
+        sync.timeline_value = it.second;
+        syncs.push_back(sync);
+    }
+
+    ret = mos_vm_bind_async_xe(bufmgr_gem->fd,
+                bo_gem->bo.vm_id,
+                0,
+                0,
+                bo_gem->bo.offset64,
+                bo_gem->bo.size,
+                bo_gem->pat_index,
+                DRM_XE_VM_BIND_OP_UNMAP,
+                syncs.data(),
+                syncs.size());
+
+    bufmgr_gem->sync_obj_rw_lock.unlock_shared();
+    bufmgr_gem->m_lock.unlock();
 
     return ret;
 }
 
-static int mos_vm_bind_async_xe(int fd, uint32_t vm_id, uint32_t bo, uint64_t offset,
-        uint64_t addr, uint64_t size, uint16_t pat_index, uint32_t op,
-        struct drm_xe_sync *sync, uint32_t num_syncs)
+static void
+__mos_bo_cache_add_bucket_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, unsigned long size)
 {
-    return __mos_vm_bind_xe(fd, vm_id, 0, bo, offset, addr, size, pat_index,
-                op, 0, sync, num_syncs,    0);
+    int i = bufmgr_gem->num_buckets;
+
+    if (i >= MOS_XE_BO_CACHE_BUCKET_MAX)
+    {
+        MOS_DRM_ASSERTMESSAGE("too many bo cache buckets");
+        return;
+    }
+
+    DRMINITLISTHEAD(&bufmgr_gem->cache_bucket[i].head);
+    bufmgr_gem->cache_bucket[i].size = size;
+    bufmgr_gem->num_buckets++;
+}
+
+/**
+ * Init the size classes of bo reuse cache, same as i915:
+ * 3 other sizes between each power of two to keep the waste low.
+ */
+static void
+__mos_bo_cache_init_buckets_xe(struct mos_xe_bufmgr_gem *bufmgr_gem)
+{
+    unsigned long size;
+
+    DRMINITLISTHEAD(&bufmgr_gem->cache_lru);
+    bufmgr_gem->num_buckets = 0;
+    bufmgr_gem->cache_size = 0;
+
+    __mos_bo_cache_add_bucket_xe(bufmgr_gem, PAGE_SIZE_4K);
+    __mos_bo_cache_add_bucket_xe(bufmgr_gem, PAGE_SIZE_4K * 2);
+    __mos_bo_cache_add_bucket_xe(bufmgr_gem, PAGE_SIZE_4K * 3);
+
+    for (size = 4 * PAGE_SIZE_4K; size <= MOS_XE_BO_CACHE_MAX_BO_SIZE; size *= 2)
+    {
+        __mos_bo_cache_add_bucket_xe(bufmgr_gem, size);
+        __mos_bo_cache_add_bucket_xe(bufmgr_gem, size + size * 1 / 4);
+        __mos_bo_cache_add_bucket_xe(bufmgr_gem, size + size * 2 / 4);
+        __mos_bo_cache_add_bucket_xe(bufmgr_gem, size + size * 3 / 4);
+    }
+}
+
+static struct mos_xe_bo_bucket *
+__mos_bo_cache_bucket_for_size_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, unsigned long size)
+{
+    if (!bufmgr_gem->bo_reuse)
+    {
+        return nullptr;
+    }
+
+    for (int i = 0; i < bufmgr_gem->num_buckets; i++)
+    {
+        struct mos_xe_bo_bucket *bucket = &bufmgr_gem->cache_bucket[i];
+        if (bucket->size >= size)
+        {
+            return bucket;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * Round up the allocation size to its size class, so that it could be reused
+ * by any allocation of the same class once released.
+ */
+static unsigned long
+__mos_bo_cache_size_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, unsigned long size)
+{
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+    struct mos_xe_bo_bucket *bucket = __mos_bo_cache_bucket_for_size_xe(bufmgr_gem, size);
+
+    return bucket ? bucket->size : size;
+}
+
+static void
+__mos_bo_cache_remove_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, struct mos_xe_bo_gem *bo_gem)
+{
+    DRMLISTDEL(&bo_gem->cache_head);
+    DRMLISTDEL(&bo_gem->cache_lru_head);
+    bufmgr_gem->cache_size -= bo_gem->bo.size;
+}
+
+/**
+ * Frees cached bos older than @time, and the oldest ones until @required
+ * bytes more fit into the cache. Must be called with m_lock held.
+ */
+static void
+__mos_bo_cache_trim_xe(struct mos_xe_bufmgr_gem *bufmgr_gem, time_t time, uint64_t required)
+{
+    while (!DRMLISTEMPTY(&bufmgr_gem->cache_lru))
+    {
+        struct mos_xe_bo_gem *bo_gem = DRMLISTENTRY(struct mos_xe_bo_gem,
+                    bufmgr_gem->cache_lru.next, cache_lru_head);
+
+        if (time - bo_gem->free_time <= 1 &&
+            bufmgr_gem->cache_size + required <= MOS_XE_BO_CACHE_MAX_TOTAL_SIZE)
+        {
+            break;
+        }
+
+        __mos_bo_cache_remove_xe(bufmgr_gem, bo_gem);
+        mos_bo_free_xe(&bo_gem->bo);
+    }
+}
+
+/**
+ * Frees cached bos idle for more than a second, at most once per second.
+ * Called on alloc and exec so that a process which stops freeing bos does
+ * not keep the cache pinned. Must be called with m_lock held.
+ */
+static void
+__mos_bo_cache_expire_xe(struct mos_xe_bufmgr_gem *bufmgr_gem)
+{
+    struct timespec time;
+
+    if (DRMLISTEMPTY(&bufmgr_gem->cache_lru))
+    {
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    if (bufmgr_gem->cache_time == time.tv_sec)
+    {
+        return;
+    }
+
+    __mos_bo_cache_trim_xe(bufmgr_gem, time.tv_sec, 0);
+    bufmgr_gem->cache_time = time.tv_sec;
+}
+
+static void
+__mos_bo_cache_purge_xe(struct mos_xe_bufmgr_gem *bufmgr_gem)
+{
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+
+    while (!DRMLISTEMPTY(&bufmgr_gem->cache_lru))
+    {
+        struct mos_xe_bo_gem *bo_gem = DRMLISTENTRY(struct mos_xe_bo_gem,
+                    bufmgr_gem->cache_lru.next, cache_lru_head);
+
+        __mos_bo_cache_remove_xe(bufmgr_gem, bo_gem);
+        mos_bo_free_xe(&bo_gem->bo);
+    }
+}
+
+/**
+ * Get an idle bo out of the reuse cache.
+ *
+ * The cached bo must match the size class, placement, cpu caching mode and
+ * pat_index of the request; it is still bound in the vm with the same
+ * pat_index, so no vm bind is needed. Idleness is checked through the bo
+ * read/write deps; the bucket is in free order, so stop at the first busy one.
+ */
+static struct mos_xe_bo_gem *
+__mos_bo_cache_get_xe(struct mos_xe_bufmgr_gem *bufmgr_gem,
+            struct mos_drm_bo_alloc *alloc)
+{
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+
+    __mos_bo_cache_expire_xe(bufmgr_gem);
+
+    struct mos_xe_bo_bucket *bucket = __mos_bo_cache_bucket_for_size_xe(bufmgr_gem, alloc->size);
+    if (nullptr == bucket || DRMLISTEMPTY(&bucket->head))
+    {
+        return nullptr;
+    }
+
+    int mem_region = MEMZONE_SYS;
+    uint32_t bo_align = MAX(alloc->alignment, bufmgr_gem->default_alignment[MOS_XE_MEM_CLASS_SYSMEM]);
+    bool cpu_cacheable = alloc->ext.cpu_cacheable;
+    if (bufmgr_gem->has_vram &&
+            (MOS_MEMPOOL_VIDEOMEMORY == alloc->ext.mem_type || MOS_MEMPOOL_DEVICEMEMORY == alloc->ext.mem_type))
+    {
+        mem_region = MEMZONE_DEVICE;
+        bo_align = MAX(alloc->alignment, bufmgr_gem->default_alignment[MOS_XE_MEM_CLASS_VRAM]);
+        cpu_cacheable = false;
+    }
+    uint16_t cpu_caching = cpu_cacheable ? DRM_XE_GEM_CPU_CACHING_WB : DRM_XE_GEM_CPU_CACHING_WC;
+    uint16_t pat_index = alloc->ext.pat_index == PAT_INDEX_INVALID ? 0 : alloc->ext.pat_index;
+    uint64_t size = ALIGN(bucket->size, bo_align);
+
+    struct mos_xe_bo_gem *bo_gem = nullptr;
+    drmMMListHead *entry;
+    for (entry = bucket->head.next; entry != &bucket->head; entry = entry->next)
+    {
+        struct mos_xe_bo_gem *candidate = DRMLISTENTRY(struct mos_xe_bo_gem, entry, cache_head);
+        if (candidate->mem_region != mem_region ||
+            candidate->cpu_caching != cpu_caching ||
+            candidate->pat_index != pat_index ||
+            candidate->bo.size != size ||
+            candidate->bo.align != bo_align)
+        {
+            continue;
+        }
+
+        if (mos_gem_bo_busy_xe(&candidate->bo))
+        {
+            break;
+        }
+
+        bo_gem = candidate;
+        break;
+    }
+
+    if (nullptr == bo_gem)
+    {
+        return nullptr;
+    }
+
+    __mos_bo_cache_remove_xe(bufmgr_gem, bo_gem);
+
+    DRMINITLISTHEAD(&bo_gem->name_list);
+    memcpy(bo_gem->name, alloc->name, (strlen(alloc->name) + 1) > MAX_NAME_SIZE ? MAX_NAME_SIZE : (strlen(alloc->name) + 1));
+    atomic_set(&bo_gem->map_count, 0);
+    atomic_set(&bo_gem->ref_count, 1);
+
+    MOS_DRM_NORMALMESSAGE("buf %d (%s) %ldb, bo:0x%lx reused",
+        bo_gem->gem_handle, alloc->name, alloc->size, (uint64_t)&bo_gem->bo);
+
+    return bo_gem;
+}
+
+/**
+ * Put a released bo into the reuse cache instead of unbinding and closing it.
+ *
+ * Shared bos (userptr, imported or exported) are never cached.
+ * Returns true if the bo is cached.
+ */
+static bool
+__mos_bo_cache_put_xe(struct mos_linux_bo *bo)
+{
+    struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *) bo->bufmgr;
+    struct mos_xe_bo_gem *bo_gem = (struct mos_xe_bo_gem *) bo;
+    struct timespec time;
+
+    if (nullptr == bufmgr_gem ||
+        bo_gem->is_userptr ||
+        bo_gem->is_imported ||
+        bo_gem->is_exported ||
+        bo->vm_id == INVALID_VM ||
+        bo->size > MOS_XE_BO_CACHE_MAX_BO_SIZE)
+    {
+        return false;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    std::lock_guard<std::recursive_mutex> lock(bufmgr_gem->m_lock);
+
+    struct mos_xe_bo_bucket *bucket = __mos_bo_cache_bucket_for_size_xe(bufmgr_gem, bo->size);
+    if (nullptr == bucket || ALIGN(bucket->size, bo->align) != bo->size)
+    {
+        return false;
+    }
+
+    // a bo which failed to bind is not bound for reuse
+    if (bufmgr_gem->failed_binds.count(bo->offset64))
+    {
+        return false;
+    }
+
+    __mos_bo_cache_trim_xe(bufmgr_gem, time.tv_sec, bo->size);
+
+    bo_gem->exec_list.clear();
+    bo_gem->free_time = time.tv_sec;
+    DRMLISTADDTAIL(&bo_gem->cache_head, &bucket->head);
+    DRMLISTADDTAIL(&bo_gem->cache_lru_head, &bufmgr_gem->cache_lru);
+    bufmgr_gem->cache_size += bo->size;
+
+    return true;
 }
 
 drm_export struct mos_linux_bo *
@@ -1276,6 +1845,12 @@ mos_bo_alloc_xe(struct mos_bufmgr *bufmgr,
     uint32_t bo_align = alloc->alignment;
     int ret;
 
+    bo_gem = __mos_bo_cache_get_xe(bufmgr_gem, alloc);
+    if (bo_gem)
+    {
+        return &bo_gem->bo;
+    }
+
     /**
      * Note: must use MOS_New to allocate buffer instead of malloc since mos_xe_bo_gem
      * contains std::vector and std::map. Otherwise both will have no instance.
@@ -1314,7 +1889,7 @@ mos_bo_alloc_xe(struct mos_bufmgr *bufmgr,
 
     //Note: We suggest vm_id=0 here as default, otherwise this bo cannot be exported as prelim fd.
     create.vm_id = 0;
-    create.size = ALIGN(alloc->size, bo_align);
+    create.size = ALIGN(__mos_bo_cache_size_xe(bufmgr_gem, alloc->size), bo_align);
 
     /**
      * Note: current, it only supports WB/ WC while UC and other cache are not allowed.
@@ -1365,24 +1940,15 @@ mos_bo_alloc_xe(struct mos_bufmgr *bufmgr,
 
     __mos_bo_set_offset_xe(&bo_gem->bo);
 
-    ret = mos_vm_bind_sync_xe(bufmgr_gem->fd,
-                    bufmgr_gem->vm_id,
+    // Bound with the next exec, a bind error fails the execs using this bo (see mos_bo_alloc)
+    __mos_vm_bind_queue_xe(bufmgr_gem,
                     bo_gem->gem_handle,
                     0,
                     bo_gem->bo.offset64,
                     bo_gem->bo.size,
                     bo_gem->pat_index,
                     DRM_XE_VM_BIND_OP_MAP);
-    if (ret)
-    {
-        MOS_DRM_ASSERTMESSAGE("mos_vm_bind_sync_xe ret: %d", ret);
-        mos_bo_free_xe(&bo_gem->bo);
-        return nullptr;
-    }
-    else
-    {
-        bo_gem->bo.vm_id = bufmgr_gem->vm_id;
-    }
+    bo_gem->bo.vm_id = bufmgr_gem->vm_id;
 
     return &bo_gem->bo;
 }
@@ -1493,7 +2059,6 @@ mos_bo_alloc_userptr_xe(struct mos_bufmgr *bufmgr,
 {
     struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *) bufmgr;
     struct mos_xe_bo_gem *bo_gem;
-    int ret;
 
     /**
      * Note: must use MOS_New to allocate buffer instead of malloc since mos_xe_bo_gem
@@ -1533,25 +2098,22 @@ mos_bo_alloc_userptr_xe(struct mos_bufmgr *bufmgr,
 
     __mos_bo_set_offset_xe(&bo_gem->bo);
 
-    ret = mos_vm_bind_sync_xe(bufmgr_gem->fd,
-                bufmgr_gem->vm_id,
+    __mos_vm_bind_queue_xe(bufmgr_gem,
                 0,
                 (uint64_t)alloc_uptr->addr,
                 bo_gem->bo.offset64,
                 bo_gem->bo.size,
                 bo_gem->pat_index,
                 DRM_XE_VM_BIND_OP_MAP_USERPTR);
+    bo_gem->bo.vm_id = bufmgr_gem->vm_id;
 
-    if (ret)
+    // An invalid user range is only detected by the bind, report it to the caller
+    if (__mos_vm_bind_sync_xe(bufmgr_gem, bo_gem->bo.offset64))
     {
-        MOS_DRM_ASSERTMESSAGE("mos_xe_vm_bind_userptr_sync ret: %d", ret);
-        mos_bo_free_xe(&bo_gem->bo);
+        MOS_DRM_ASSERTMESSAGE("mos_bo_alloc_userptr_xe: failed to bind buf (%s) %ldb", alloc_uptr->name, alloc_uptr->size);
+        mos_bo_unreference_xe(&bo_gem->bo);
         return nullptr;
     }
-    else
-    {
-        bo_gem->bo.vm_id = bufmgr_gem->vm_id;
-    }
 
     MOS_DRM_NORMALMESSAGE("mos_bo_alloc_userptr_xe: buf (%s) %ldb, bo:0x%lx",
         alloc_uptr->name, alloc_uptr->size, (uint64_t)&bo_gem->bo);
@@ -1638,24 +2200,22 @@ mos_bo_create_from_prime_xe(struct mos_bufmgr *bufmgr, int prime_fd, int size)
 
     __mos_bo_set_offset_xe(&bo_gem->bo);
 
-    ret = mos_vm_bind_sync_xe(bufmgr_gem->fd,
-                bufmgr_gem->vm_id,
+    __mos_vm_bind_queue_xe(bufmgr_gem,
                 bo_gem->gem_handle,
                 0,
                 bo_gem->bo.offset64,
                 bo_gem->bo.size,
                 bo_gem->pat_index,
                 DRM_XE_VM_BIND_OP_MAP);
-    if (ret)
+    bo_gem->bo.vm_id = bufmgr_gem->vm_id;
+
+    // An imported bo that can't be mapped, e.g. in an unsupported region, is only detected by the bind
+    if (__mos_vm_bind_sync_xe(bufmgr_gem, bo_gem->bo.offset64))
     {
-        MOS_DRM_ASSERTMESSAGE("mos_vm_bind_sync_xe ret: %d", ret);
-        mos_bo_free_xe(&bo_gem->bo);
+        MOS_DRM_ASSERTMESSAGE("create_from_prime: failed to bind handle %d", handle);
+        mos_bo_unreference_xe(&bo_gem->bo);
         return nullptr;
     }
-    else
-    {
-        bo_gem->bo.vm_id = bufmgr_gem->vm_id;
-    }
 
     return &bo_gem->bo;
 }
@@ -2431,6 +2991,16 @@ mos_bo_context_exec_with_sync_xe(struct mos_linux_bo **bo, int num_bo, struct mo
     }
 
     bufmgr_gem->m_lock.lock();
+    __mos_bo_cache_expire_xe(bufmgr_gem);
+    //submit queued vm binds, only an exec using a bo which failed to bind is rejected
+    __mos_vm_bind_flush_xe(bufmgr_gem);
+    if (__mos_vm_bind_failed_xe(bufmgr_gem, bo, num_bo, exec_list))
+    {
+        MOS_DRM_ASSERTMESSAGE("Exec uses bo not bound to vm");
+        bufmgr_gem->m_lock.unlock();
+        return -EFAULT;
+    }
+
     //get available timeline from engine queue and add it into syncs as fence out point.
     struct mos_xe_dep *dep = mos_sync_update_exec_syncs_from_timeline_queue(
                                     bufmgr_gem->fd,
@@ -2443,6 +3013,10 @@ mos_bo_context_exec_with_sync_xe(struct mos_linux_bo **bo, int num_bo, struct mo
         bufmgr_gem->m_lock.unlock();
         return -EINVAL;
     }
+
+    //wait for submitted vm binds as fence in
+    __mos_vm_bind_update_exec_syncs_xe(bufmgr_gem, syncs);
+
     bufmgr_gem->sync_obj_rw_lock.lock_shared();
     //update exec syncs array by external and interbal bo dep
     __mos_context_exec_update_syncs_xe(
@@ -2454,6 +3028,8 @@ mos_bo_context_exec_with_sync_xe(struct mos_linux_bo **bo, int num_bo, struct mo
                 syncs,
                 used_internal_deps,
                 external_bos);
+    //bos sharing one exec queue carry the same syncobj, wait each of them only once
+    mos_sync_dedup_exec_syncs(syncs);
 
     //exec submit
     uint32_t sync_count = syncs.size();
@@ -2914,10 +3490,25 @@ mos_query_device_blob_xe(struct mos_bufmgr *bufmgr, MEDIA_SYSTEM_INFO* gfx_info)
     return 0;
 }
 
+/**
+ * Enables the bo reuse cache.
+ *
+ * Unlike i915, the cache is bounded by MOS_XE_BO_CACHE_MAX_TOTAL_SIZE, since
+ * cached bos also keep their vm binding and gpu va.
+ */
 static void
 mos_enable_reuse_xe(struct mos_bufmgr *bufmgr)
 {
-    MOS_UNIMPLEMENT(bufmgr);
+    struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *) bufmgr;
+
+    if (nullptr == bufmgr_gem)
+    {
+        return;
+    }
+
+    bufmgr_gem->m_lock.lock();
+    bufmgr_gem->bo_reuse = true;
+    bufmgr_gem->m_lock.unlock();
 }
 
 // The function is not supported on KMD
@@ -2951,7 +3542,14 @@ mos_bo_free_xe(struct mos_linux_bo *bo)
         return;
     }
 
-    mos_gem_bo_wait_rendering_xe(bo);
+    /**
+     * The user memory of userptr bo may be released by the caller right after it is freed,
+     * so wait for rendering; other bos are released by KMD after the deferred unbind.
+     */
+    if (bo_gem->is_userptr)
+    {
+        mos_gem_bo_wait_rendering_xe(bo);
+    }
 
     bufmgr_gem->m_lock.lock();
 
@@ -2964,16 +3562,15 @@ mos_bo_free_xe(struct mos_linux_bo *bo)
         }
     }
 
+    if(bo->vm_id != INVALID_VM && __mos_vm_bind_cancel_xe(bufmgr_gem, bo->offset64))
+    {
+        // never bound to vm
+        bo->vm_id = INVALID_VM;
+    }
+
     if(bo->vm_id != INVALID_VM)
     {
-        ret = mos_vm_bind_sync_xe(bufmgr_gem->fd,
-                    bo->vm_id,
-                    0,
-                    0,
-                    bo->offset64,
-                    bo->size,
-                    bo_gem->pat_index,
-                    DRM_XE_VM_BIND_OP_UNMAP);
+        ret = __mos_vm_unbind_deferred_xe(bufmgr_gem, bo_gem);
         if (ret)
         {
             MOS_DRM_ASSERTMESSAGE("mos_gem_bo_free mos_vm_unbind ret error. bo:0x%lx, vm_id:%d\r",
@@ -3037,6 +3634,17 @@ mos_bufmgr_gem_destroy_xe(struct mos_bufmgr *bufmgr)
     struct mos_xe_bufmgr_gem *bufmgr_gem = (struct mos_xe_bufmgr_gem *) bufmgr;
     int i, ret;
 
+    /* Release bos kept hanging around in the reuse cache. */
+    __mos_bo_cache_purge_xe(bufmgr_gem);
+
+    for (auto handle : bufmgr_gem->bind_syncobjs)
+    {
+        mos_sync_syncobj_destroy(bufmgr_gem->fd, handle);
+    }
+    bufmgr_gem->bind_syncobjs.clear();
+    bufmgr_gem->pending_binds.clear();
+    bufmgr_gem->failed_binds.clear();
+
     /* Release userptr bo kept hanging around for optimisation. */
 
     mos_vma_heap_finish(&bufmgr_gem->vma_heap[MEMZONE_SYS]);
@@ -3374,6 +3982,7 @@ mos_bufmgr_gem_init_xe(int fd, int batch_size)
     bufmgr_gem->fd = fd;
     bufmgr_gem->vm_id = INVALID_VM;
     atomic_set(&bufmgr_gem->ref_count, 1);
+    __mos_bo_cache_init_buckets_xe(bufmgr_gem);
 
     bufmgr_gem->bufmgr.vm_create = mos_vm_create_xe;
     bufmgr_gem->bufmgr.vm_destroy = mos_vm_destroy_xe;
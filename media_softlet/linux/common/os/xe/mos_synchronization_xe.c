@@ -529,22 +529,23 @@ void mos_sync_clear_dep_list(int fd, std::list<struct mos_xe_dep*> &temp_list)
 int mos_sync_update_exec_syncs_from_timeline_deps(uint32_t curr_engine,
             uint32_t lst_write_engine, uint32_t flags,
             std::set<uint32_t> &engine_ids,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps,
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps,
             std::vector<drm_xe_sync> &syncs)
 {
     if (lst_write_engine != curr_engine)
     {
-        if (write_deps.count(lst_write_engine) > 0
+        struct mos_xe_bo_dep *write_dep = write_deps.find(lst_write_engine);
+        if (write_dep
                 && engine_ids.count(lst_write_engine) > 0)
         {
-            if(write_deps[lst_write_engine].dep)
+            if(write_dep->dep)
             {
                 drm_xe_sync sync;
                 memclear(sync);
-                sync.handle = write_deps[lst_write_engine].dep->sync.handle;
+                sync.handle = write_dep->dep->sync.handle;
                 sync.type = DRM_XE_SYNC_TYPE_TIMELINE_SYNCOBJ;
-                sync.timeline_value = write_deps[lst_write_engine].exec_timeline_index;
+                sync.timeline_value = write_dep->exec_timeline_index;
                 syncs.push_back(sync);
             }
         }
@@ -654,8 +655,8 @@ struct mos_xe_dep *mos_sync_update_exec_syncs_from_timeline_queue(int fd,
  */
 int mos_sync_update_bo_deps(uint32_t curr_engine,
             uint32_t flags, mos_xe_dep *dep,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps)
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps)
 {
     MOS_DRM_CHK_NULL_RETURN_VALUE(dep, -EINVAL)
     mos_xe_bo_dep bo_dep;
@@ -663,12 +664,12 @@ int mos_sync_update_bo_deps(uint32_t curr_engine,
     bo_dep.exec_timeline_index = dep->timeline_index;
     if(flags & EXEC_OBJECT_READ_XE)
     {
-        read_deps[curr_engine] = bo_dep;
+        read_deps.set(curr_engine, bo_dep);
     }
 
     if(flags & EXEC_OBJECT_WRITE_XE)
     {
-        write_deps[curr_engine] = bo_dep;
+        write_deps.set(curr_engine, bo_dep);
     }
 
     return MOS_XE_SUCCESS;
@@ -686,8 +687,8 @@ int mos_sync_update_bo_deps(uint32_t curr_engine,
  *     if rw_flags & EXEC_OBJECT_WRITE_XE, means bo write. Otherwise it means bo read.
  */
 void mos_sync_get_bo_wait_timeline_deps(std::set<uint32_t> &engine_ids,
-            std::map<uint32_t, struct mos_xe_bo_dep> &read_deps,
-            std::map<uint32_t, struct mos_xe_bo_dep> &write_deps,
+            struct mos_xe_bo_dep_map &read_deps,
+            struct mos_xe_bo_dep_map &write_deps,
             std::map<uint32_t, uint64_t> &max_timeline_data,
             uint32_t lst_write_engine,
             uint32_t rw_flags)
@@ -711,12 +712,13 @@ void mos_sync_get_bo_wait_timeline_deps(std::set<uint32_t> &engine_ids,
     }
 
     //case2: get timeline dep from write dep on last write engine.
+    struct mos_xe_bo_dep *write_dep = write_deps.find(lst_write_engine);
     if (engine_ids.count(lst_write_engine) > 0
-        && write_deps.count(lst_write_engine) > 0
-       && write_deps[lst_write_engine].dep)
+        && write_dep
+       && write_dep->dep)
     {
-        uint32_t syncobj_handle = write_deps[lst_write_engine].dep->sync.handle;
-        uint64_t bo_exec_timeline = write_deps[lst_write_engine].exec_timeline_index;
+        uint32_t syncobj_handle = write_dep->dep->sync.handle;
+        uint64_t bo_exec_timeline = write_dep->exec_timeline_index;
         if (max_timeline_data.count(syncobj_handle) == 0
                 || max_timeline_data[syncobj_handle] < bo_exec_timeline)
         {
@@ -725,3 +727,40 @@ void mos_sync_get_bo_wait_timeline_deps(std::set<uint32_t> &engine_ids,
         }
     }
 }
+
+/**
+ * Merge the timeline fence-in syncs that share the same syncobj.
+ *
+ * Bos executed on the same exec queue usually carry the same dep, so the exec
+ * syncs array would otherwise list one syncobj many times. Only the max timeline
+ * point of each syncobj needs to be waited; fence-out and binary syncs are kept as is.
+ *
+ * @syncs indicates to exec syncs array for current exec.
+ */
+void mos_sync_dedup_exec_syncs(std::vector<struct drm_xe_sync> &syncs)
+{
+    std::unordered_map<uint32_t, uint32_t> timeline_pos;
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < syncs.size(); i++)
+    {
+        struct drm_xe_sync &sync = syncs[i];
+        if (sync.type == DRM_XE_SYNC_TYPE_TIMELINE_SYNCOBJ
+                && !(sync.flags & DRM_XE_SYNC_FLAG_SIGNAL))
+        {
+            auto it = timeline_pos.find(sync.handle);
+            if (it != timeline_pos.end())
+            {
+                if (syncs[it->second].timeline_value < sync.timeline_value)
+                {
+                    syncs[it->second].timeline_value = sync.timeline_value;
+                }
+                continue;
+            }
+            timeline_pos[sync.handle] = count;
+        }
+        syncs[count++] = sync;
+    }
+
+    syncs.resize(count);
+}